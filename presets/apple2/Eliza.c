@@ -14,8 +14,15 @@
 
 #define NUMKEYWORDS 37
 #define MAXLINELEN 40
+#define MAXREPLYLEN 128
 #define NUMSWAPS 14
 
+// use the compressed tables, made from the plain ones by tools/elizadict.py
+#ifndef COMPRESSED_TEXT
+#define COMPRESSED_TEXT 1
+#endif
+
+#if !COMPRESSED_TEXT
 const char *keywords[]= {
        "CAN YOU","CAN I","YOU ARE","YOURE","I DONT","I FEEL",
        "WHY DONT YOU","WHY CANT I","ARE YOU","I CANT","I AM","IM ",
@@ -24,6 +31,7 @@ const char *keywords[]= {
        "NAME","CAUSE","SORRY","DREAM","HELLO","HI ","MAYBE",
        " NO","YOUR","ALWAYS","THINK","ALIKE","YES","FRIEND",
        "COMPUTER","CAR","NOKEYFOUND"};
+#endif
 
 const char *SWAPS[NUMSWAPS][2] = {
     {"ARE","AM"},
@@ -48,9 +56,10 @@ int ResponsesPerKeyword[NUMKEYWORDS]= {
        3,5,9,9,9,9,
        9,9,
        2,4,4,4,1,1,5,
-       5,2,4,3,7,3,6,
-       7,5,6};
-           
+       5,2,4,3,6,4,6,
+       7,5,7};
+
+#if !COMPRESSED_TEXT
 const char *responses[NUMKEYWORDS][9] = { 
     {   "DON'T YOU BELIEVE THAT I CAN*",
         "PERHAPS YOU WOULD LIKE TO BE ABLE TO*",
@@ -227,6 +236,273 @@ const char *responses[NUMKEYWORDS][9] = {
     
 };
 
+#define KEYWORD_LEN(k) strlen(keywords[k])
+
+#else
+
+/* generated by tools/elizadict.py -- do not edit */
+/* 117 responses, 3387 bytes of text packed into 1755 bytes */
+#define NUMRESPONSES 117
+#define NUMPAIRS 128
+#define PAIR_DEPTH 4
+#define TRIE_NODES 135
+#define NOKEYWORD 255
+const unsigned char pair_left[128] = {
+  0x4f,0x59,0x20,0x82,0x45,0x54,0x44,0x48,0x52,0x49,0x53,0x87,0x86,0x45,0x41,0x59,
+  0x54,0x4f,0x54,0x57,0x45,0x52,0x88,0x44,0x45,0x45,0x49,0x4e,0x52,0x57,0x4e,0x54,
+  0x41,0x41,0x45,0x53,0x53,0x82,0x84,0x86,0x89,0x4f,0x41,0x4c,0x53,0x82,0x9d,0x43,
+  0x4f,0xa1,0x20,0x43,0x4c,0x54,0x56,0x85,0x41,0x41,0x43,0x4e,0x50,0x53,0x54,0x56,
+  0x89,0x92,0x42,0x46,0x49,0x50,0x50,0x54,0x54,0x57,0x80,0x84,0x85,0x86,0x87,0x8d,
+  0x96,0xa7,0xa8,0xbc,0x2c,0x41,0x4f,0x51,0x54,0x89,0x91,0x94,0xa3,0xa6,0xc3,0xca,
+  0x20,0x47,0x49,0x49,0x49,0x4c,0x4c,0x4c,0x4d,0x4f,0x81,0x8e,0x91,0x9b,0xa0,0xa4,
+  0xcb,0xcd,0xd0,0xd3,0x41,0x41,0x42,0x43,0x44,0x45,0x45,0x45,0x46,0x47,0x48,0x49,
+};
+const unsigned char pair_right[128] = {
+  0x55,0x80,0x81,0x20,0x20,0x20,0x4f,0x41,0x45,0x4e,0x20,0x85,0x83,0x52,0x4e,0x20,
+  0x4f,0x4e,0x48,0x8b,0x4e,0x20,0x41,0x20,0x4c,0x8a,0x20,0x4f,0x49,0x48,0x27,0x49,
+  0x42,0x88,0x53,0x45,0x55,0x95,0x90,0x9e,0x47,0x4d,0x52,0x45,0x3f,0x3f,0x8f,0x48,
+  0x52,0x83,0x42,0xa9,0x4c,0x8b,0x45,0x4d,0x4d,0x53,0x8e,0x45,0x8d,0x54,0x2a,0x84,
+  0x4b,0xc0,0x45,0x9c,0x8a,0x4f,0xab,0x83,0x84,0x8e,0x4c,0xa0,0x90,0x99,0x50,0x20,
+  0xb4,0x85,0x20,0xce,0x20,0x4c,0x46,0x55,0x45,0x20,0x8a,0x44,0x45,0x2a,0xdb,0x97,
+  0x4d,0x4f,0x4b,0x53,0x85,0x4f,0xdd,0xe2,0x20,0x57,0x20,0x8f,0x20,0x85,0x80,0x88,
+  0xe6,0xb5,0x8f,0x53,0x59,0xaf,0xab,0xaa,0x96,0x97,0x98,0xbf,0xfa,0x49,0xe9,0x46,
+};
+const unsigned char packed_text[1499] = {
+  0xa7,0xc7,0x42,0x98,0x49,0xfb,0xb5,0x9a,0xba,0x2a,0x00,0xf3,0x83,0x57,0xdf,0xe7,
+  0xa6,0xb2,0xf0,0x00,0xea,0xc9,0xb7,0xa6,0xb2,0xf0,0x00,0xf3,0x83,0xd1,0xc9,0xcc,
+  0x2a,0x00,0x8c,0xc9,0xcc,0xb2,0xf0,0x00,0x93,0x4d,0x41,0x4b,0xa2,0x83,0xc1,0x20,
+  0x9a,0xb8,0x2a,0x00,0xcd,0xe4,0xc6,0x41,0xa3,0x83,0x90,0xb2,0x98,0x49,0xfb,0x9a,
+  0xb8,0x2a,0x00,0xf3,0x83,0x57,0xdf,0xe7,0xa6,0xb2,0x45,0x2a,0x00,0x8c,0x53,0xa9,
+  0x45,0x9f,0x4d,0x99,0x57,0xe3,0x48,0x83,0x57,0x45,0x88,0x2a,0x00,0xa7,0xc7,0xd0,
+  0x59,0x2a,0x00,0xae,0xa7,0x54,0x82,0x2a,0x00,0x8c,0x57,0xe3,0x48,0x20,0x90,0xb2,
+  0xf0,0x00,0xf1,0x54,0x52,0x80,0xf6,0xad,0x00,0x54,0x98,0x4c,0xe0,0x84,0x4d,0xb0,
+  0xcb,0x80,0x85,0xa4,0xaf,0x20,0xfc,0xa8,0x53,0x2e,0x00,0x8c,0xd6,0x54,0x94,0x20,
+  0xfc,0x2a,0x00,0x8c,0x94,0x4a,0x4f,0x8f,0xfc,0xa8,0x2a,0x00,0x8c,0xf2,0x42,0x98,
+  0x49,0xfb,0x9a,0xa7,0xbe,0x00,0xd3,0x8a,0xd9,0xe1,0x4f,0x97,0x9f,0x4d,0x84,0x9a,
+  0x57,0x49,0xb4,0x2a,0x00,0x8c,0xc9,0xb7,0xdd,0x00,0x8c,0xc1,0x83,0x53,0x48,0xdf,
+  0x42,0xf0,0x00,0xae,0xba,0x27,0x54,0x82,0x2a,0x00,0xae,0xb1,0x89,0xd8,0x88,0xbd,
+  0xf9,0xd9,0x9d,0x45,0x92,0xcf,0x4f,0x95,0xed,0x9a,0xb8,0x2a,0x00,0x57,0xca,0x44,
+  0x83,0x50,0x88,0x46,0xcf,0xff,0x20,0x9a,0x57,0x8d,0x84,0x9b,0xbe,0x00,0xd3,0x8a,
+  0x89,0xa5,0x46,0x8e,0x54,0xb9,0x49,0x99,0x9a,0xb8,0x2a,0x00,0xfe,0x20,0x8c,0x4b,
+  0x9b,0x57,0x83,0xba,0x27,0xbe,0x00,0x87,0xb6,0x83,0x54,0x9c,0x45,0x44,0x3f,0x00,
+  0xf3,0x83,0xba,0x20,0x9b,0x57,0x2a,0x00,0x44,0x49,0x44,0x83,0xb3,0xa6,0xe0,0x84,
+  0xc2,0x43,0x41,0x55,0xa3,0x83,0xa1,0x2a,0x00,0xfe,0x20,0x4c,0x91,0x47,0x20,0x87,
+  0xb6,0x83,0xc2,0x94,0x2a,0x00,0x8c,0x42,0x98,0x49,0xfb,0xe4,0xc4,0x9b,0x52,0x4d,
+  0xd5,0x20,0x90,0xb2,0x45,0x2a,0x00,0x8c,0x94,0x4a,0x4f,0x8f,0xc2,0xa8,0x2a,0x00,
+  0x57,0x84,0x57,0x8d,0x84,0x44,0xe3,0x43,0x55,0x53,0x53,0xa8,0x82,0x2d,0x2d,0x20,
+  0x9b,0xb7,0x45,0x2e,0x00,0x4f,0x48,0xd4,0x49,0x2a,0x00,0x81,0x27,0x52,0x84,0xed,
+  0xf2,0x54,0xd5,0x4b,0xd2,0xee,0xb7,0x45,0xd4,0xa1,0xad,0x00,0x93,0x57,0xdf,0x49,
+  0xb7,0x45,0x8e,0x20,0x90,0x83,0xff,0x83,0xe1,0xbe,0x00,0xae,0x8c,0xc9,0xbe,0x00,
+  0xa4,0x50,0xc5,0xa3,0x83,0x53,0x4f,0xec,0xe1,0xbe,0x00,0x93,0xff,0x83,0xbb,0x56,
+  0xcf,0xe1,0xbe,0x00,0x9a,0x53,0xa9,0x45,0x9f,0x4d,0x99,0xd5,0x53,0x4f,0x20,0xc9,
+  0xbe,0x00,0xae,0x8c,0xb9,0x4b,0x3f,0x00,0xf1,0xd7,0xa2,0x9f,0xec,0x89,0xd8,0x88,
+  0xbd,0xad,0x00,0x93,0x8e,0x53,0x57,0xcf,0x57,0xdf,0xc6,0x41,0xa3,0x83,0x92,0x84,
+  0x4d,0x4f,0xbd,0x3f,0x00,0x93,0x8c,0xc1,0x3f,0x00,0xaa,0x84,0xa4,0xaf,0x20,0xd7,
+  0xa2,0x9f,0xda,0x91,0xa5,0x4d,0x89,0x97,0xd6,0x54,0x94,0x3f,0x00,0x93,0xc4,0xe4,
+  0x54,0x87,0xc7,0xf2,0xc9,0xcc,0x20,0x4b,0x9b,0x57,0x3f,0x00,0x87,0xb6,0x83,0xb9,
+  0x4b,0xf9,0x8e,0x59,0x91,0x84,0x98,0xa3,0x3f,0x00,0x87,0xb6,0x83,0xb9,0x4b,0xf9,
+  0xa4,0xaf,0x20,0xd7,0xa2,0x9f,0xda,0xc2,0x46,0x4f,0x88,0x3f,0x00,0x93,0x98,0x53,
+  0x84,0xb3,0x99,0x90,0xe0,0x89,0x97,0x9d,0x94,0x83,0xb9,0x4b,0x20,0x54,0x87,0x54,
+  0x3f,0x00,0x4e,0xb8,0x99,0xd1,0x89,0xd8,0x88,0x53,0xb7,0x45,0x2e,0x00,0x9a,0xd1,
+  0xf7,0xcb,0x80,0x85,0x4e,0xb8,0xa2,0x2d,0x2d,0x20,0xc6,0xb9,0x84,0xe1,0x20,0x91,
+  0x2e,0x00,0xc4,0xb5,0x92,0x84,0x96,0x4c,0x20,0x96,0x53,0x91,0x3f,0x00,0xd1,0xeb,
+  0x4f,0x92,0xcf,0x96,0x53,0xda,0xb3,0xa6,0xe0,0x89,0x44,0x3f,0x00,0xf1,0x96,0x53,
+  0xec,0x45,0x58,0x50,0x4c,0x41,0xd9,0xeb,0x92,0xd2,0x98,0xa3,0x3f,0x00,0x93,0x4f,
+  0x92,0xcf,0x96,0x53,0xda,0x4d,0x49,0x47,0x48,0x85,0x92,0x8d,0x84,0xc2,0x3f,0x00,
+  0xc6,0xb9,0x84,0xd1,0x41,0xc5,0xe5,0xfd,0x5a,0x45,0x2e,0x00,0x41,0xc5,0xe5,0xfd,
+  0x99,0xaa,0x84,0xed,0xbb,0x43,0xa2,0x53,0xaa,0x59,0x2e,0x00,0x93,0xfc,0xa8,0x8a,
+  0x8c,0x87,0xbf,0x9d,0x94,0x83,0x41,0xc5,0xe5,0xfd,0x5a,0x45,0x3f,0x00,0xd1,0x42,
+  0x84,0x53,0x4f,0x20,0x44,0x45,0x46,0x94,0x53,0x49,0xb6,0x21,0x00,0x93,0xf1,0xf8,
+  0xe8,0xa4,0x47,0x47,0xa2,0xcc,0xad,0x00,0x8c,0xf8,0xe8,0xd6,0x54,0x94,0x3f,0x00,
+  0x93,0xbc,0x53,0xda,0x41,0x50,0x50,0x45,0x41,0x95,0x89,0xa5,0xf8,0x4d,0xac,0x00,
+  0xb1,0x44,0x49,0xbd,0x55,0x52,0xc2,0x97,0x42,0x59,0xa5,0xf8,0x4d,0xac,0x00,0xfe,
+  0x20,0x8c,0x86,0x2d,0x2d,0xc6,0xb9,0x84,0xbd,0x41,0xd8,0xa5,0x50,0x52,0x4f,0xf6,
+  0x4d,0x2e,0x00,0xea,0xd1,0xdc,0xe8,0xd7,0x49,0xc8,0x43,0x8d,0x54,0x41,0x89,0x2e,
+  0x00,0xae,0x92,0x84,0x55,0x4e,0x43,0x8d,0x54,0x41,0xd9,0x90,0xbb,0x3f,0x00,0xba,
+  0x27,0xc7,0x42,0x84,0x4d,0xb0,0x84,0xc5,0x53,0x49,0x9f,0xb6,0x3f,0x00,0xea,0xa1,
+  0x9e,0x85,0xef,0x3f,0x00,0xa7,0xc7,0x4b,0x9b,0x57,0x3f,0x00,0xb1,0x53,0xf4,0xd2,
+  0x9b,0x20,0x4a,0x55,0x53,0xcc,0xb2,0x84,0xbb,0x47,0x41,0x9f,0xb6,0x3f,0x00,0xea,
+  0xaa,0x84,0xc2,0xd2,0x41,0xb2,0xe4,0xbb,0x47,0x41,0x9f,0xb6,0x2e,0x00,0xae,0x9b,
+  0x54,0x3f,0x00,0xb1,0xef,0x3f,0x00,0xae,0x9b,0x3f,0x00,0xae,0xb1,0x43,0x91,0x43,
+  0x8d,0xbb,0x97,0xee,0xb7,0x59,0x2a,0x00,0x93,0xee,0x54,0xa5,0xe9,0x4e,0x2a,0x00,
+  0xba,0x83,0xc1,0x20,0xd6,0x20,0x41,0x20,0x53,0x50,0x45,0x43,0xff,0x49,0x43,0x20,
+  0x45,0x58,0xb8,0xc6,0x3f,0x00,0x9d,0x94,0x3f,0x00,0x93,0xb1,0xc1,0xd2,0xd6,0x3f,
+  0x00,0xd0,0x59,0xd4,0xd5,0x57,0xf4,0xac,0x00,0x8c,0xf2,0xc1,0x20,0x53,0x4f,0x3f,
+  0x00,0x42,0x55,0xc7,0xaa,0x84,0xed,0xef,0x82,0x2a,0x00,0x8c,0x44,0x80,0x42,0x54,
+  0x82,0x2a,0x00,0xd9,0x93,0x57,0xf4,0x3f,0x00,0x93,0x88,0xa3,0x4d,0x42,0x4c,0x8e,
+  0x43,0x84,0x8c,0xdc,0x3f,0x00,0x93,0xcd,0x92,0x84,0x53,0x49,0x4d,0x49,0x4c,0x41,
+  0x9c,0x54,0x8f,0xa4,0x47,0x47,0xa2,0xcc,0xad,0x00,0x93,0x4f,0x92,0xcf,0x43,0x91,
+  0xbb,0x43,0x9f,0xda,0x8c,0xdc,0x3f,0x00,0x43,0xdf,0x92,0x8d,0x84,0xf2,0x42,0x84,
+  0x53,0xa9,0x84,0x43,0x91,0xbb,0x43,0x9f,0x91,0x3f,0x00,0xfe,0x3f,0x00,0xea,0xdc,
+  0xe8,0xd7,0x49,0xc8,0xc5,0x53,0x49,0x9f,0xb6,0x2e,0x00,0xb1,0xef,0x3f,0x00,0x9a,
+  0xdc,0x2e,0x00,0x9a,0x55,0x4e,0x44,0x8d,0xbd,0x8e,0x44,0x2e,0x00,0xae,0x8c,0x42,
+  0x52,0xd2,0x55,0x50,0x20,0x92,0xa6,0x50,0x49,0x43,0x20,0xd6,0x20,0xde,0xac,0x00,
+  0x86,0xa5,0xde,0x8a,0x57,0xb0,0x52,0x59,0xad,0x00,0x86,0xa5,0xde,0x8a,0x50,0x49,
+  0x43,0x4b,0x20,0x91,0xad,0x00,0xb1,0xef,0x83,0x87,0xbf,0xeb,0xde,0xac,0x00,0x8c,
+  0x49,0x4d,0xc5,0x53,0x84,0x91,0xa5,0xde,0xac,0x00,0xf3,0xa5,0xe5,0xbf,0x46,0x4f,
+  0x95,0xde,0x8a,0x57,0xb0,0x9c,0xa2,0xad,0x00,0x86,0x20,0xb3,0x50,0x55,0x54,0x8d,
+  0x8a,0x57,0xb0,0x52,0x59,0xad,0x00,0xb1,0x54,0xd5,0x4b,0xd2,0xee,0xb7,0x84,0xd9,
+  0x50,0xaa,0x9f,0x43,0x55,0x4c,0xaa,0x3f,0x00,0xb1,0xc3,0x47,0x48,0x54,0x94,0xf9,
+  0x42,0x8f,0x4d,0xf5,0x89,0xa2,0x3f,0x00,0xae,0x8c,0x4d,0x94,0x9f,0xec,0xb3,0x50,
+  0x55,0x54,0x8d,0xac,0x00,0x93,0x8c,0xc1,0xe0,0xf5,0x89,0x99,0x87,0x56,0xa6,0x20,
+  0x86,0x20,0x57,0x49,0x92,0xa5,0x50,0x52,0x4f,0xf6,0x4d,0x3f,0x00,0xa7,0xc7,0xc1,
+  0x20,0xb3,0x50,0x55,0x54,0x8d,0x8a,0xba,0x20,0x48,0x98,0x50,0x20,0x50,0x45,0x4f,
+  0xc6,0x3f,0x00,0x93,0xc4,0xe4,0xee,0xb7,0xf5,0x89,0x99,0xb5,0x57,0xb0,0x9c,0xa2,
+  0xad,0x00,0x4f,0x48,0xd4,0x8c,0xe7,0x84,0xf7,0xac,0x00,0x4d,0x8f,0x46,0x41,0x56,
+  0x4f,0x9c,0xc8,0x43,0x41,0x95,0xc4,0x41,0x20,0x4c,0xb8,0x42,0xb0,0x47,0x89,0x9a,
+  0x43,0x80,0x4e,0x54,0xf5,0x2e,0x20,0x93,0xe3,0xa5,0x46,0x41,0x56,0x4f,0x9c,0xc8,
+  0x20,0x20,0x20,0x20,0xf7,0x3f,0x00,0x4d,0x8f,0x46,0x41,0x56,0x4f,0x9c,0xc8,0x43,
+  0x41,0x95,0xb3,0x50,0xeb,0xc4,0x46,0x8d,0x52,0x41,0x9c,0x2e,0x20,0x20,0x93,0xe3,
+  0x82,0x52,0xac,0x00,0x8c,0xe7,0x84,0x50,0xb0,0x53,0xaf,0xa2,0x3f,0x00,0x8c,0xe7,
+  0x84,0x50,0xb0,0x53,0xaf,0x84,0x54,0x55,0x52,0x42,0x4f,0x20,0xf7,0x88,0x52,0x41,
+  0xac,0x00,0x53,0xf4,0xd4,0x8c,0x87,0xbf,0xeb,0x50,0x53,0x59,0xaf,0x4f,0xe5,0xfd,
+  0x43,0xd5,0x20,0x50,0x52,0x4f,0xf6,0x4d,0xac,0x00,0x93,0xf1,0xa4,0x47,0x47,0xa2,
+  0xcc,0xad,0x00,0x9a,0xdc,0x2e,0x00,0x49,0x27,0xe8,0xed,0xa4,0x52,0x84,0x9a,0x55,
+  0x4e,0x44,0x8d,0xbd,0x8e,0x44,0x83,0x46,0x55,0xb4,0x59,0x2e,0x00,0xb3,0x45,0xd4,
+  0xb3,0x84,0x98,0x55,0x43,0x49,0x44,0x41,0xd8,0xa5,0x92,0x80,0x47,0x48,0x54,0x53,
+  0x2e,0x00,0xba,0x83,0x98,0xa0,0xb0,0x41,0xc8,0xec,0x54,0x87,0x54,0x3f,0x00,0xb5,
+  0xc4,0xd7,0x49,0xc8,0x89,0xd8,0x88,0xbd,0xa8,0x2e,0x00,
+};
+const unsigned short response_ofs[117] = {
+  0,11,20,27,34,40,52,67,77,93,99,105,
+  114,121,139,147,156,166,181,186,195,202,221,238,
+  252,263,272,280,297,310,327,336,357,363,380,395,
+  400,411,420,434,440,451,469,474,493,508,522,541,
+  562,574,594,606,621,638,656,668,684,702,717,728,
+  736,752,767,787,801,815,830,837,844,863,878,883,
+  887,891,904,912,934,938,945,953,961,971,979,985,
+  998,1018,1032,1051,1054,1067,1071,1075,1085,1104,1114,1126,
+  1135,1146,1161,1175,1193,1208,1221,1245,1267,1282,1291,1335,
+  1364,1374,1394,1418,1427,1431,1453,1474,1487,
+};
+const unsigned char first_response[37] = {
+  0,3,5,5,9,13,16,19,21,24,27,27,31,34,39,39,
+  39,39,39,39,48,50,54,58,62,62,63,68,73,75,79,82,
+  88,92,98,105,110,
+};
+const unsigned char keyword_len[37] = {
+  7,5,7,5,6,6,12,10,7,6,4,3,4,6,4,3,
+  3,5,4,3,4,5,5,5,5,3,5,3,4,6,5,5,
+  3,6,8,3,10,
+};
+const unsigned char trie_root[64] = {
+  103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,46,0,1,87,0,121,0,67,18,0,0,0,98,75,0,
+  0,0,0,82,111,0,0,28,0,9,0,0,0,0,0,0,
+};
+const unsigned char trie_edge[136] = {
+  0,0,2,5,6,8,9,10,10,10,12,13,15,16,17,18,
+  18,19,19,21,26,27,28,29,29,30,31,32,32,33,37,38,
+  40,41,42,43,44,45,46,47,47,48,49,50,51,52,52,54,
+  55,56,57,58,59,59,60,61,62,62,63,63,64,64,65,66,
+  67,67,68,68,71,72,72,72,74,75,75,75,76,77,78,78,
+  79,80,80,81,82,83,84,84,85,86,87,88,88,89,90,91,
+  91,92,92,93,94,95,96,96,97,98,98,100,101,102,103,103,
+  104,105,106,107,107,108,109,109,110,110,111,112,113,114,115,115,
+  116,117,118,119,120,121,121,121,
+};
+const char edge_char[121] = {
+  'A','O','N','R','U',' ','I','Y','O','U','E','O','U',' ','R','A',
+  'R','E','E',' ','M','A','C','D','F','W','O','N','T','E','E','L',
+  'H','A','E','O','Y',' ','C','D','O','N','T',' ','Y','O','U','A',
+  'N','T',' ','I','L','R','E',' ','Y','O','U','A','N','T','M',' ',
+  'A','N','T','T','E','I','O','W','N','R','E','A','M','E','S','E',
+  'O','R','R','Y','R','E','A','M','L','L','O',' ','A','Y','B','E',
+  'N','O','I','W','A','Y','S','H','I','N','K','K','E','S','R','I',
+  'E','N','D','M','P','U','T','E','R',
+};
+const unsigned char edge_next[121] = {
+  2,127,3,134,79,4,8,5,6,7,119,10,11,12,16,13,
+  14,15,17,19,59,57,53,20,24,61,21,22,23,25,26,27,
+  29,65,71,70,30,31,40,32,33,34,35,36,37,38,39,41,
+  42,43,44,45,106,47,48,49,50,51,52,54,55,56,58,60,
+  62,63,64,66,92,96,68,69,74,72,73,76,77,78,80,81,
+  83,84,85,86,88,89,90,91,93,94,95,97,99,100,101,102,
+  104,105,116,107,108,109,110,112,113,114,115,117,118,120,122,123,
+  124,125,126,128,129,130,131,132,133,
+};
+const unsigned char trie_keyword[135] = {
+  255,255,255,255,255,255,255,0,1,255,255,255,12,255,255,2,
+  28,3,255,255,255,255,255,4,255,255,255,5,255,255,19,255,
+  255,255,255,255,255,255,255,6,255,255,255,255,255,7,255,255,
+  255,255,255,255,8,255,255,255,9,255,10,255,11,255,255,255,
+  13,255,14,255,255,15,16,255,255,17,18,255,255,255,20,255,
+  255,21,255,255,255,255,22,255,255,255,255,23,255,255,255,24,
+  255,25,255,255,255,255,26,255,255,27,255,255,255,255,29,255,
+  255,255,255,30,255,255,31,255,32,255,255,255,255,255,33,255,
+  255,255,255,255,255,34,35,
+};
+
+#define KEYWORD_LEN(k) keyword_len[k]
+
+// expand response n into response[]
+char response[MAXREPLYLEN];
+
+void unpack_response(unsigned char n) {
+  const unsigned char *src = packed_text + response_ofs[n];
+  unsigned char stack[PAIR_DEPTH];
+  unsigned char sp = 0;
+  unsigned char i = 0;
+  unsigned char c;
+
+  while ((c = *src++) != 0) {
+    for (;;) {
+      // a pair: do the left half now, the right half later
+      while (c & 0x80) {
+        stack[sp] = pair_right[c & 0x7f];
+        ++sp;
+        c = pair_left[c & 0x7f];
+      }
+      response[i] = c;
+      ++i;
+      if (sp == 0)
+        break;
+      c = stack[--sp];
+    }
+  }
+  response[i] = '\0';
+}
+
+// find the first keyword (in table order) contained in the input,
+// and where it first occurs; NUMKEYWORDS-1 if there are none
+int find_keyword(char *instr, char **location) {
+  unsigned char best = NUMKEYWORDS-1;
+  unsigned char where = 0;
+  unsigned char i, j, node, e, end, kw;
+  char c;
+
+  for (i = 0; (c = instr[i]) != '\0'; i++) {
+    if ((unsigned char)(c - ' ') >= 64)
+      continue;
+    node = trie_root[c - ' '];
+    j = i;
+    while (node) {
+      kw = trie_keyword[node];
+      if (kw < best) {
+        // strictly lower, so we keep its first occurrence
+        best = kw;
+        where = i;
+      }
+      // follow the next character down the trie
+      c = instr[++j];
+      e = trie_edge[node];
+      end = trie_edge[node+1];
+      node = 0;
+      for (; e < end; e++) {
+        if (edge_char[e] == c) {
+          node = edge_next[e];
+          break;
+        }
+      }
+    }
+  }
+  *location = instr + where;
+  return best;
+}
+
+#endif
+
 void print_center(const char *msg) {
   int numspaces=(MAXLINELEN-strlen(msg))/2;
   int i;  
@@ -270,7 +546,7 @@ void main()
   int k,baseLength; 
   int whichReply[NUMKEYWORDS];
   char lastinput[MAXLINELEN];
-  char reply[MAXLINELEN];
+  char reply[MAXREPLYLEN];
   char *baseResponse, *token;
   const char separator[2]=" ";
   char inputstr[MAXLINELEN];
@@ -307,16 +583,25 @@ void main()
     // see if any of the keywords is contained in the input 
     // if not, we use the last element of keywords as our default responses 
     strcpy(reply,"");
+#if COMPRESSED_TEXT
+    k = find_keyword(inputstr, &location);
+#else
     for(k=0;k<NUMKEYWORDS-1;k++)
     {
       location=strstr(inputstr, keywords[k]); 
       if(location != NULL)
         break;
     }
+#endif
 
     // Build Eliza's response 
     // start with Eliza's canned response, based on the keyword match
+#if COMPRESSED_TEXT
+    unpack_response(first_response[k] + whichReply[k]);
+    baseResponse = response;
+#else
     baseResponse = (char *) responses[k][whichReply[k]];
+#endif
     baseLength = strlen(baseResponse);
 
     if(baseResponse[baseLength-1] != '*')
@@ -332,7 +617,7 @@ void main()
 
       // now add in the rest of the user's input, starting at <location>
       // but skip over the keyword itself
-      location+=strlen(keywords[k]);
+      location+=KEYWORD_LEN(k);
       // take them one word at a time, so that we can substitute pronouns
       token = strtok(location, separator);
       while(token != NULL)
@@ -120,65 +120,81 @@ void xor_pixel(byte x, byte y) {
   xor_vline(x, y, y);		// draw line with 1-pixel height
 }
 
-typedef enum {
-  OP_DRAW, OP_XOR, OP_ERASE
-} GraphicsOperation;
-
-// render a sprite with the given graphics operation
-byte render_sprite(const byte* src, byte x, byte y, byte op) {
+// sprite pre-shifted to all 7 pixel offsets within a byte
+// (see tools/apple2/hgrshift.py)
+typedef struct {
+  byte w,h;		// bytes per row (one more than source), rows
+  const byte* shift[7];	// w*h bytes of row data for each x MOD 7
+} ShiftedSprite;
+
+// draw a sprite, overwriting the background
+void draw_sprite(const ShiftedSprite* spr, byte x, byte y) {
+  register const byte* src = spr->shift[MOD7[x]];
+  register byte* dest;
   byte i,j;
-  byte w = *src++;	// get width from 1st byte of sprite
-  byte h = *src++;	// get height from 2nd byte of sprite
-  byte xb = DIV7[x];	// xb = x DIV 7
-  byte xs = MOD7[x];	// xs = x MOD 7
-  byte result = 0;	// result (used only with XOR)
+  byte w = spr->w;
+  byte h = spr->h;
+  byte xb = DIV7[x];
   for (j=0; j<h; j++) {
-    byte* dest = &vidmem[y++][xb];	// lookup video address
-    byte rest = 0;			// rest = leftover bits
-    for (i=0; i<w; i++) {
-      byte data = *src++;		// get next sprite byte
-      byte next = (data << xs) | rest; // shift and OR with leftover
-      // compute graphics operation, write to dest
-      switch (op) {
-        case OP_DRAW:  *dest++ = next; break;
-        case OP_XOR:   result |= (*dest++ ^= next); break;
-        case OP_ERASE: *dest++ &= ~next; break;
-      }
-      rest = data >> (7-xs);	// save leftover bits
-    }
-    // compute final byte operation
-    switch (op) {
-      case OP_DRAW:  *dest = rest; break;
-      case OP_XOR:   result |= (*dest ^= rest); break;
-      case OP_ERASE: *dest &= ~rest; break;
+    dest = &vidmem[y++][xb];
+    for (i=w; i; i--) {
+      *dest = *src++;
+      ++dest;	// cc65 makes faster code than *dest++
     }
   }
-  return result;
-}
-
-void draw_sprite(const byte* src, byte x, byte y) {
-  render_sprite(src, x, y, OP_DRAW);
 }
 
 // XOR returns non-zero if any pixels were overlapped
-byte xor_sprite(const byte* src, byte x, byte y) {
-  return render_sprite(src, x, y, OP_XOR);
+byte xor_sprite(const ShiftedSprite* spr, byte x, byte y) {
+  register const byte* src = spr->shift[MOD7[x]];
+  register byte* dest;
+  byte i,j;
+  byte w = spr->w;
+  byte h = spr->h;
+  byte xb = DIV7[x];
+  byte result = 0;
+  byte data;
+  for (j=0; j<h; j++) {
+    dest = &vidmem[y++][xb];
+    for (i=w; i; i--) {
+      data = *dest ^ *src++;
+      *dest = data;
+      ++dest;
+      result |= data;
+    }
+  }
+  return result;
 }
 
-void erase_sprite(const byte* src, byte x, byte y) {
-  render_sprite(src, x, y, OP_ERASE);
+// clear only the sprite's set pixels
+void erase_sprite(const ShiftedSprite* spr, byte x, byte y) {
+  register const byte* src = spr->shift[MOD7[x]];
+  register byte* dest;
+  byte i,j;
+  byte w = spr->w;
+  byte h = spr->h;
+  byte xb = DIV7[x];
+  for (j=0; j<h; j++) {
+    dest = &vidmem[y++][xb];
+    for (i=w; i; i--) {
+      *dest &= ~*src++;
+      ++dest;
+    }
+  }
 }
 
 // clear just sets all bytes to 0, and is fast
-void clear_sprite(const byte* src, byte x, byte y) {
+void clear_sprite(const ShiftedSprite* spr, byte x, byte y) {
+  register byte* dest;
   byte i,j;
-  byte w = *src++;
-  byte h = *src++;
+  byte w = spr->w;
+  byte h = spr->h;
   byte xb = DIV7[x];
   for (j=0; j<h; j++) {
-    byte* dest = &vidmem[y++][xb];
-    for (i=0; i<=w; i++) {
-      dest[i] = 0;
+    dest = &vidmem[y++][xb];
+    for (i=w; i; i--) {
+      *dest = 0;
+      ++dest;
     }
   }
 }
@@ -238,6 +254,9 @@ word bcd_add(word a, word b) {
 // GAME GRAPHICS
 //
 
+// the sprites as drawn, for tools/apple2/hgrshift.py; the game only
+// uses the shifted copies made from them, so these stay out of the ROM
+#if 0
 const byte player_bitmap[] =
 {3,16,/*{w:24,h:16,bpp:1}*/0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x04,0x18,0x20,0x04,0x18,0x20,0x0C,0x3C,0x30,0x3C,0x3C,0x3C,0xCC,0xE7,0x33,0x0C,0x66,0x30,0xC4,0xE7,0x23,0x34,0xE7,0x2C,0x0C,0x7E,0x30,0xCC,0xFF,0x33,0x3C,0x18,0x3C,0x0C,0x18,0x30,0x04,0x18,0x20};
 const byte bomb_bitmap[] =
@@ -252,12 +271,93 @@ const byte enemy3_bitmap[] =
 {2,16,/*{w:16,h:16,bpp:1}*/0x00,0x00,0x00,0x00,0x04,0x20,0x05,0xA0,0x05,0xA0,0x25,0xA4,0xA7,0xE5,0xF7,0xEF,0xF7,0xEF,0xFE,0x7F,0xFC,0x3F,0xBC,0x3D,0xE4,0x27,0x20,0x00,0x00,0x00,0x00,0x00};
 const byte enemy4_bitmap[] =
 {2,16,/*{w:16,h:16,bpp:1}*/0x00,0x00,0x00,0x00,0xF0,0x0F,0xF8,0x1F,0xD8,0x1B,0xF8,0x1F,0xF8,0x1F,0xF8,0x1F,0xF0,0x0F,0xA8,0x15,0xCC,0x33,0xE8,0x17,0x66,0x66,0x33,0xCC,0x61,0x86,0x40,0x02};
-
-const byte* const enemy_bitmaps[4] = {
-  enemy1_bitmap,
-  enemy2_bitmap,
-  enemy3_bitmap,
-  enemy4_bitmap
+#endif
+
+// generated from the bitmaps above:
+// python3 tools/apple2/hgrshift.py presets/apple2/cosmic.c
+const byte player_shifted[7][64] = {
+{0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x3C,0x00,0x00,0x04,0x18,0x20,0x00,0x04,0x18,0x20,0x00,0x0C,0x3C,0x30,0x00,0x3C,0x3C,0x3C,0x00,0xCC,0xE7,0x33,0x00,0x0C,0x66,0x30,0x00,0xC4,0xE7,0x23,0x00,0x34,0xE7,0x2D,0x00,0x0C,0x7E,0x30,0x00,0xCC,0xFF,0x33,0x00,0x3C,0x18,0x3C,0x00,0x0C,0x18,0x30,0x00,0x04,0x18,0x20,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x78,0x00,0x00,0x08,0x30,0x40,0x00,0x08,0x30,0x40,0x00,0x18,0x78,0x60,0x00,0x78,0x78,0x78,0x00,0x98,0xCF,0x67,0x00,0x18,0xCC,0x61,0x00,0x88,0xCF,0x47,0x00,0x68,0xCE,0x5B,0x00,0x18,0xFC,0x61,0x00,0x98,0xFF,0x67,0x00,0x78,0x30,0x78,0x00,0x18,0x30,0x60,0x00,0x08,0x30,0x40,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xF0,0x01,0x00,0x10,0x60,0x80,0x01,0x10,0x60,0x80,0x01,0x30,0xF0,0xC1,0x01,0xF0,0xF1,0xF1,0x01,0x30,0x9E,0xCF,0x01,0x30,0x98,0xC3,0x01,0x10,0x9E,0x8F,0x01,0xD0,0x9D,0xB7,0x01,0x30,0xF8,0xC3,0x01,0x30,0xFE,0xCF,0x01,0xF0,0x61,0xF0,0x01,0x30,0x60,0xC0,0x01,0x10,0x60,0x80,0x01},
+{0x00,0x00,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xE0,0x03,0x00,0x20,0xC0,0x01,0x02,0x20,0xC0,0x01,0x02,0x60,0xE0,0x83,0x03,0xE0,0xE3,0xE3,0x03,0x60,0x3C,0x9E,0x03,0x60,0x30,0x86,0x03,0x20,0x3C,0x1E,0x02,0xA0,0x3B,0x6E,0x02,0x60,0xF0,0x87,0x03,0x60,0xFC,0x9F,0x03,0xE0,0xC3,0xE1,0x03,0x60,0xC0,0x81,0x03,0x20,0xC0,0x01,0x02},
+{0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xC0,0x07,0x00,0x40,0x80,0x03,0x04,0x40,0x80,0x03,0x04,0xC0,0xC1,0x07,0x06,0xC0,0xC7,0xC7,0x07,0xC0,0x79,0x3C,0x06,0xC0,0x61,0x0C,0x06,0x40,0x78,0x3C,0x04,0x40,0x76,0xDC,0x05,0xC0,0xE1,0x0F,0x06,0xC0,0xF9,0x3F,0x06,0xC0,0x87,0xC3,0x07,0xC0,0x81,0x03,0x06,0x40,0x80,0x03,0x04},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x80,0x0F,0x00,0x80,0x01,0x06,0x08,0x80,0x01,0x06,0x08,0x80,0x83,0x0F,0x0C,0x80,0x8F,0x8F,0x0F,0x80,0xF3,0x79,0x0C,0x80,0xC3,0x19,0x0C,0x80,0xF1,0x79,0x08,0x80,0xED,0xB9,0x0B,0x80,0xC3,0x1F,0x0C,0x80,0xF3,0x7F,0x0C,0x80,0x0F,0x86,0x0F,0x80,0x03,0x06,0x0C,0x80,0x01,0x06,0x08},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x1E,0x00,0x00,0x02,0x0C,0x10,0x00,0x02,0x0C,0x10,0x00,0x06,0x1E,0x18,0x00,0x1E,0x1E,0x1E,0x00,0xE6,0xF3,0x19,0x00,0x86,0x33,0x18,0x00,0xE2,0xF3,0x11,0x00,0xDA,0x73,0x16,0x00,0x86,0x3F,0x18,0x00,0xE6,0xFF,0x19,0x00,0x1E,0x0C,0x1E,0x00,0x06,0x0C,0x18,0x00,0x02,0x0C,0x10},
+};
+const ShiftedSprite player_sprite = {4,16,{
+  player_shifted[0],player_shifted[1],player_shifted[2],player_shifted[3],player_shifted[4],player_shifted[5],player_shifted[6]}};
+const byte bomb_shifted[7][10] = {
+{0x88,0x01,0x55,0x00,0x77,0x00,0x55,0x00,0x88,0x01},
+{0x10,0x02,0xAA,0x01,0xEE,0x01,0xAA,0x01,0x10,0x02},
+{0x20,0x04,0x54,0x02,0xDC,0x03,0x54,0x02,0x20,0x04},
+{0x40,0x08,0xA8,0x05,0xB8,0x07,0xA8,0x05,0x40,0x08},
+{0x80,0x11,0x50,0x0A,0x70,0x0E,0x50,0x0A,0x80,0x11},
+{0x00,0x22,0xA0,0x15,0xE0,0x1D,0xA0,0x15,0x00,0x22},
+{0x00,0x44,0x40,0x2A,0xC0,0x3B,0x40,0x2A,0x00,0x44},
+};
+const ShiftedSprite bomb_sprite = {2,5,{
+  bomb_shifted[0],bomb_shifted[1],bomb_shifted[2],bomb_shifted[3],bomb_shifted[4],bomb_shifted[5],bomb_shifted[6]}};
+const byte bullet_shifted[7][10] = {
+{0x14,0x00,0x28,0x00,0x14,0x00,0x14,0x00,0x28,0x00},
+{0x28,0x00,0x50,0x00,0x28,0x00,0x28,0x00,0x50,0x00},
+{0x50,0x00,0xA0,0x01,0x50,0x00,0x50,0x00,0xA0,0x01},
+{0xA0,0x01,0x40,0x02,0xA0,0x01,0xA0,0x01,0x40,0x02},
+{0x40,0x02,0x80,0x05,0x40,0x02,0x40,0x02,0x80,0x05},
+{0x80,0x05,0x00,0x0A,0x80,0x05,0x80,0x05,0x00,0x0A},
+{0x00,0x0A,0x00,0x14,0x00,0x0A,0x00,0x0A,0x00,0x14},
+};
+const ShiftedSprite bullet_sprite = {2,5,{
+  bullet_shifted[0],bullet_shifted[1],bullet_shifted[2],bullet_shifted[3],bullet_shifted[4],bullet_shifted[5],bullet_shifted[6]}};
+const byte enemy1_shifted[7][48] = {
+{0x00,0x00,0x00,0x70,0x38,0x00,0xF8,0x7D,0x00,0xFC,0xFD,0x01,0xFE,0xFD,0x01,0xFE,0xFF,0x01,0xFC,0xFF,0x01,0xF8,0x7F,0x00,0xF0,0x3F,0x00,0x88,0x47,0x00,0xF0,0x3F,0x00,0xF0,0x3F,0x00,0xD0,0x2F,0x00,0x8C,0xC7,0x01,0x48,0x48,0x00,0x80,0x05,0x00},
+{0x00,0x00,0x00,0xE0,0x71,0x00,0xF0,0xFB,0x01,0xF8,0xFB,0x03,0xFC,0xFB,0x03,0xFC,0xFF,0x03,0xF8,0xFF,0x03,0xF0,0xFF,0x01,0xE0,0x7F,0x00,0x10,0x8E,0x01,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xA0,0x5F,0x00,0x18,0x8E,0x03,0x90,0x91,0x01,0x00,0x0A,0x00},
+{0x00,0x00,0x00,0xC0,0xE3,0x01,0xE0,0xF7,0x03,0xF0,0xF7,0x07,0xF8,0xF7,0x07,0xF8,0xFF,0x07,0xF0,0xFF,0x07,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0x20,0x1C,0x02,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x40,0xBE,0x01,0x30,0x1C,0x06,0x20,0x22,0x02,0x00,0x14,0x00},
+{0x00,0x00,0x00,0x80,0xC7,0x03,0xC0,0xEF,0x07,0xE0,0xEF,0x0F,0xF0,0xEF,0x0F,0xF0,0xFF,0x0F,0xE0,0xFF,0x0F,0xC0,0xFF,0x07,0x80,0xFF,0x03,0x40,0x38,0x04,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0x7D,0x02,0x60,0x38,0x0C,0x40,0x44,0x04,0x00,0x28,0x00},
+{0x00,0x00,0x00,0x00,0x8E,0x07,0x80,0xDF,0x0F,0xC0,0xDF,0x1F,0xE0,0xDF,0x1F,0xE0,0xFF,0x1F,0xC0,0xFF,0x1F,0x80,0xFF,0x0F,0x00,0xFE,0x07,0x80,0x71,0x08,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0xFA,0x05,0xC0,0x71,0x18,0x80,0x89,0x09,0x00,0x50,0x00},
+{0x00,0x00,0x00,0x00,0x1C,0x0E,0x00,0xBE,0x1F,0x80,0xBF,0x3F,0xC0,0xBF,0x3F,0xC0,0xFF,0x3F,0x80,0xFF,0x3F,0x00,0xFE,0x1F,0x00,0xFC,0x0F,0x00,0xE2,0x11,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xF4,0x0B,0x80,0xE3,0x31,0x00,0x12,0x12,0x00,0xA0,0x01},
+{0x00,0x00,0x00,0x00,0x38,0x1C,0x00,0x7C,0x3E,0x00,0x7E,0x7E,0x80,0x7F,0x7E,0x80,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xFC,0x3F,0x00,0xF8,0x1F,0x00,0xC4,0x23,0x00,0xF8,0x1F,0x00,0xF8,0x1F,0x00,0xE8,0x17,0x00,0xC6,0x63,0x00,0x24,0x24,0x00,0x40,0x02},
+};
+const ShiftedSprite enemy1_sprite = {3,16,{
+  enemy1_shifted[0],enemy1_shifted[1],enemy1_shifted[2],enemy1_shifted[3],enemy1_shifted[4],enemy1_shifted[5],enemy1_shifted[6]}};
+const byte enemy2_shifted[7][48] = {
+{0x00,0x00,0x00,0x30,0x0C,0x00,0x14,0x28,0x00,0x2E,0x74,0x00,0x08,0x10,0x00,0x20,0x04,0x00,0xE0,0x07,0x00,0xD0,0x0B,0x00,0xB0,0x0D,0x00,0xB2,0x4D,0x00,0x19,0x98,0x01,0x8E,0x71,0x00,0x82,0x41,0x00,0xB1,0x8D,0x01,0x59,0x9A,0x01,0x4A,0x52,0x00},
+{0x00,0x00,0x00,0x60,0x18,0x00,0x28,0x50,0x00,0x5C,0xE8,0x01,0x10,0x20,0x00,0x40,0x08,0x00,0xC0,0x0F,0x00,0xA0,0x17,0x00,0x60,0x1A,0x00,0x64,0x9A,0x01,0x32,0x30,0x02,0x1C,0xE2,0x01,0x04,0x82,0x01,0x62,0x1A,0x02,0xB2,0x35,0x02,0x94,0xA5,0x01},
+{0x00,0x00,0x00,0xC0,0x31,0x00,0x50,0xA0,0x01,0xB8,0xD1,0x03,0x20,0x40,0x00,0x80,0x11,0x00,0x80,0x1F,0x00,0x40,0x2E,0x00,0xC0,0x35,0x00,0xC8,0x35,0x02,0x64,0x60,0x04,0x38,0xC4,0x03,0x08,0x04,0x02,0xC4,0x35,0x04,0x64,0x6A,0x04,0x28,0x4A,0x02},
+{0x00,0x00,0x00,0x80,0x63,0x00,0xA0,0x41,0x02,0x70,0xA2,0x07,0x40,0x80,0x01,0x00,0x22,0x00,0x00,0x3E,0x00,0x80,0x5D,0x00,0x80,0x6B,0x00,0x90,0x6B,0x04,0xC8,0xC1,0x09,0x70,0x88,0x07,0x10,0x08,0x04,0x88,0x6B,0x08,0xC8,0xD5,0x09,0x50,0x94,0x05},
+{0x00,0x00,0x00,0x00,0xC6,0x01,0x40,0x82,0x05,0xE0,0x45,0x0E,0x80,0x01,0x02,0x00,0x44,0x00,0x00,0x7C,0x00,0x00,0xBA,0x01,0x00,0xD6,0x01,0x20,0xD6,0x09,0x90,0x83,0x13,0xE0,0x11,0x0E,0x20,0x10,0x08,0x10,0xD6,0x11,0x90,0xAB,0x13,0xA0,0x29,0x0A},
+{0x00,0x00,0x00,0x00,0x8C,0x03,0x80,0x05,0x0A,0xC0,0x8B,0x1D,0x00,0x02,0x04,0x00,0x88,0x01,0x00,0xF8,0x01,0x00,0x74,0x02,0x00,0xAC,0x03,0x40,0xAC,0x13,0x20,0x06,0x26,0xC0,0x23,0x1C,0x40,0x20,0x10,0x20,0xAC,0x23,0x20,0x56,0x26,0x40,0x52,0x14},
+{0x00,0x00,0x00,0x00,0x18,0x06,0x00,0x0A,0x14,0x80,0x17,0x3A,0x00,0x04,0x08,0x00,0x10,0x02,0x00,0xF0,0x03,0x00,0xE8,0x05,0x00,0x58,0x06,0x80,0x59,0x26,0x40,0x0C,0x4C,0x80,0x47,0x38,0x80,0x41,0x20,0x40,0x58,0x46,0x40,0xAC,0x4D,0x80,0xA5,0x29},
+};
+const ShiftedSprite enemy2_sprite = {3,16,{
+  enemy2_shifted[0],enemy2_shifted[1],enemy2_shifted[2],enemy2_shifted[3],enemy2_shifted[4],enemy2_shifted[5],enemy2_shifted[6]}};
+const byte enemy3_shifted[7][48] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x20,0x00,0x05,0xA0,0x01,0x05,0xA0,0x01,0x25,0xA4,0x01,0xA7,0xE5,0x01,0xF7,0xEF,0x01,0xF7,0xEF,0x01,0xFE,0x7F,0x00,0xFC,0x3F,0x00,0xBC,0x3D,0x00,0xE4,0x27,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x00,0x0A,0x40,0x02,0x0A,0x40,0x02,0x4A,0x48,0x02,0x4E,0xCA,0x03,0xEE,0xDF,0x03,0xEE,0xDF,0x03,0xFC,0xFF,0x01,0xF8,0x7F,0x00,0x78,0x7A,0x00,0xC8,0x4F,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x80,0x01,0x14,0x80,0x05,0x14,0x80,0x05,0x94,0x91,0x05,0x9C,0x95,0x07,0xDC,0xBF,0x07,0xDC,0xBF,0x07,0xF8,0xFF,0x03,0xF0,0xFF,0x01,0xF0,0xF5,0x01,0x90,0x9F,0x01,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x28,0x00,0x0A,0x28,0x00,0x0A,0x28,0x22,0x0A,0x38,0x2A,0x0E,0xB8,0x7F,0x0E,0xB8,0x7F,0x0E,0xF0,0xFF,0x07,0xE0,0xFF,0x03,0xE0,0xEB,0x03,0x20,0x3E,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x04,0x50,0x00,0x14,0x50,0x00,0x14,0x50,0x44,0x14,0x70,0x54,0x1C,0x70,0xFE,0x1D,0x70,0xFE,0x1D,0xE0,0xFF,0x0F,0xC0,0xFF,0x07,0xC0,0xD7,0x07,0x40,0x7C,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x08,0xA0,0x01,0x28,0xA0,0x01,0x28,0xA0,0x89,0x29,0xE0,0xA9,0x39,0xE0,0xFD,0x3B,0xE0,0xFD,0x3B,0xC0,0xFF,0x1F,0x80,0xFF,0x0F,0x80,0xAF,0x0F,0x80,0xF9,0x09,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x10,0x40,0x02,0x50,0x40,0x02,0x50,0x40,0x12,0x52,0xC0,0x53,0x72,0xC0,0xFB,0x77,0xC0,0xFB,0x77,0x80,0xFF,0x3F,0x00,0xFE,0x1F,0x00,0x5E,0x1E,0x00,0xF2,0x13,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+};
+const ShiftedSprite enemy3_sprite = {3,16,{
+  enemy3_shifted[0],enemy3_shifted[1],enemy3_shifted[2],enemy3_shifted[3],enemy3_shifted[4],enemy3_shifted[5],enemy3_shifted[6]}};
+const byte enemy4_shifted[7][48] = {
+{0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x0F,0x00,0xF8,0x1F,0x00,0xD8,0x1B,0x00,0xF8,0x1F,0x00,0xF8,0x1F,0x00,0xF8,0x1F,0x00,0xF0,0x0F,0x00,0xA8,0x15,0x00,0xCC,0x33,0x00,0xE8,0x17,0x00,0x66,0x66,0x00,0x33,0xCC,0x01,0x61,0x86,0x01,0x40,0x02,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0xF0,0x3F,0x00,0xB0,0x37,0x00,0xF0,0x3F,0x00,0xF0,0x3F,0x00,0xF0,0x3F,0x00,0xE0,0x1F,0x00,0x50,0x2A,0x00,0x98,0x67,0x00,0xD0,0x2F,0x00,0xCC,0xCD,0x01,0x66,0x98,0x03,0xC2,0x0D,0x02,0x80,0x05,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x3F,0x00,0xE0,0x7F,0x00,0x60,0x6E,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xE0,0x7F,0x00,0xC0,0x3F,0x00,0xA0,0x55,0x00,0x30,0xCE,0x01,0xA0,0x5F,0x00,0x98,0x9B,0x03,0xCC,0x31,0x06,0x84,0x1B,0x04,0x00,0x0A,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0xC0,0xFF,0x01,0xC0,0xDD,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x80,0x7F,0x00,0x40,0xAA,0x01,0x60,0x9C,0x03,0x40,0xBE,0x01,0x30,0x36,0x06,0x98,0x63,0x0C,0x08,0x36,0x08,0x00,0x14,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x80,0xFF,0x03,0x80,0xBB,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x00,0xFE,0x01,0x80,0x55,0x02,0xC0,0x39,0x06,0x80,0x7D,0x02,0x60,0x6C,0x0C,0x30,0xC6,0x19,0x10,0x6C,0x10,0x00,0x28,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0xFE,0x07,0x00,0x76,0x06,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0xFC,0x03,0x00,0xAA,0x05,0x80,0x73,0x0C,0x00,0xFA,0x05,0xC0,0xD9,0x19,0x60,0x8C,0x33,0x20,0xD8,0x21,0x00,0x50,0x00},
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x07,0x00,0xFC,0x0F,0x00,0xEC,0x0D,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xFC,0x0F,0x00,0xF8,0x07,0x00,0x54,0x0A,0x00,0xE6,0x19,0x00,0xF4,0x0B,0x80,0xB3,0x33,0xC0,0x19,0x66,0x40,0xB0,0x43,0x00,0xA0,0x01},
+};
+const ShiftedSprite enemy4_sprite = {3,16,{
+  enemy4_shifted[0],enemy4_shifted[1],enemy4_shifted[2],enemy4_shifted[3],enemy4_shifted[4],enemy4_shifted[5],enemy4_shifted[6]}};
+
+const ShiftedSprite* const enemy_sprites[4] = {
+  &enemy1_sprite,
+  &enemy2_sprite,
+  &enemy3_sprite,
+  &enemy4_sprite
 };
 
 //
@@ -278,7 +378,7 @@ byte bomb_y;
 
 typedef struct {
   byte x,y;
-  const byte* shape; // need const here
+  const ShiftedSprite* shape; // need const here
 } Enemy;
 
 #define MAX_ENEMIES 28
@@ -358,7 +458,7 @@ void xor_player_derez() {
 
 void destroy_player() {
   xor_player_derez(); // xor derez pattern
-  xor_sprite(player_bitmap, player_x, 192-17); // erase ship via xor
+  xor_sprite(&player_sprite, player_x, 192-17); // erase ship via xor
   xor_player_derez(); // xor 2x to erase derez pattern
   player_x = 0xff;
   lives--;
@@ -373,7 +473,7 @@ void init_enemies() {
     Enemy* e = &enemies[i];
     e->x = x;
     e->y = y;
-    e->shape = enemy_bitmaps[bm];
+    e->shape = enemy_sprites[bm];
     x += 29;
     if (x >= 200) {
       x = 0;
@@ -433,8 +533,8 @@ void update_next_enemy() {
 }
 
 char in_rect(Enemy* e, byte x, byte y, byte w, byte h) {
-  byte ew = e->shape[0]*8;
-  byte eh = e->shape[1];
+  byte ew = (e->shape->w-1)*8;
+  byte eh = e->shape->h;
   return (x >= e->x-w && x <= e->x+ew && y >= e->y-h && y <= e->y+eh);
 }
 
@@ -460,19 +560,19 @@ void check_bullet_hit(byte x, byte y) {
 void fire_bullet() {
   bullet_x = player_x + 13;
   bullet_y = 192-22;
-  xor_sprite(bullet_bitmap, bullet_x, bullet_y); // draw
+  xor_sprite(&bullet_sprite, bullet_x, bullet_y); // draw
 }
 
 void move_bullet() {
-  byte leftover = xor_sprite(bullet_bitmap, bullet_x, bullet_y); // erase
+  byte leftover = xor_sprite(&bullet_sprite, bullet_x, bullet_y); // erase
   if (leftover || bullet_y < 10) {
-    clear_sprite(bullet_bitmap, bullet_x, bullet_y);
+    clear_sprite(&bullet_sprite, bullet_x, bullet_y);
     check_bullet_hit(bullet_x, bullet_y+2);
     bullet_y = 0;
   } else {
     bullet_y -= 4;
     tone(bullet_y,3,0);
-    xor_sprite(bullet_bitmap, bullet_x, bullet_y); // draw
+    xor_sprite(&bullet_sprite, bullet_x, bullet_y); // draw
   }
 }
 
@@ -480,15 +580,15 @@ void drop_bomb() {
   Enemy* e = &enemies[enemy_index];
   bomb_x = e->x + 7;
   bomb_y = e->y + 16;
-  xor_sprite(bomb_bitmap, bomb_x, bomb_y);
+  xor_sprite(&bomb_sprite, bomb_x, bomb_y);
 }
 
 void move_bomb() {
-  byte leftover = xor_sprite(bomb_bitmap, bomb_x, bomb_y); // erase
+  byte leftover = xor_sprite(&bomb_sprite, bomb_x, bomb_y); // erase
   if (bomb_y > 192-12) {
     bomb_y = 0;
   } else if (leftover & 0x7f) { // don't count hi bit
-    erase_sprite(bomb_bitmap, bomb_x, bomb_y); // erase bunker
+    erase_sprite(&bomb_sprite, bomb_x, bomb_y); // erase bunker
     if (bomb_y > 192-23) {
       // player was hit (probably)
       destroy_player();
@@ -496,7 +596,7 @@ void move_bomb() {
     bomb_y = 0;
   } else {
     bomb_y += 3;
-    xor_sprite(bomb_bitmap, bomb_x, bomb_y);
+    xor_sprite(&bomb_sprite, bomb_x, bomb_y);
   }
 }
 
@@ -532,7 +632,7 @@ void move_player() {
     player_x += player_dir;
   else if (player_dir > 0 && player_x < 255-28)
     player_x += player_dir;
-  draw_sprite(player_bitmap, player_x, 192-17);
+  draw_sprite(&player_sprite, player_x, 192-17);
 }
 
 void play_round() {
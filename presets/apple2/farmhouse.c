@@ -89,6 +89,19 @@ typedef enum {
     LastItem=OldRadio
 } Item_t;
 
+/* Words findWord() knows. The items come first, so an item's word is its Item_t. */
+typedef enum {
+    NoWord,
+    WordBookcase = LastItem+1,
+    WordNorth,
+    WordSouth,
+    WordEast,
+    WordWest,
+    WordUp,
+    WordDown,
+    WordXyzzy
+} Word_t;
+
 /* Locations */
 typedef enum {
     NoLocation,
@@ -194,6 +207,13 @@ char *DescriptionOfLocation[NUMLOCATIONS] = {
 /* Inventory of what player is carrying */
 Item_t Inventory[MAXITEMS];
 
+/* The same, as one bit per item, for carryingItem() */
+unsigned char carriedItems[(LastItem+8)/8];
+
+const unsigned char BitMask[8] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
 /* Location of each item. Index is the item number, returns the location. 0 if item is gone */
 Location_t locationOfItem[LastItem+1];
 
@@ -268,6 +288,39 @@ const char *helpString = "Valid commands:\ngo east/west/north/south/up/down \nlo
 /* Line of user input */
 char buffer[40];
 
+/* Vocabulary perfect hash, made with:
+   tools/apple2/advhash.py farmhouse.c bookcase=WordBookcase north=WordNorth
+     south=WordSouth east=WordEast west=WordWest up=WordUp down=WordDown
+     n=WordNorth s=WordSouth e=WordEast w=WordWest u=WordUp d=WordDown
+     xyzzy=WordXyzzy */
+/* generated by tools/apple2/advhash.py -- do not edit */
+#define VOCAB_SEED 66
+#define VOCAB_BUCKETS 8
+#define VOCAB_SLOTS 32
+const unsigned char vocabDisp[VOCAB_BUCKETS] = {
+    3, 3, 14, 19, 19, 23, 0, 10,
+};
+const unsigned char vocabToken[VOCAB_SLOTS] = {
+    WordXyzzy, WordNorth, Key, Doll,
+    WordDown, WordBookcase, WordDown, Candybar,
+    Book, WordEast, NoWord, Flashlight,
+    WordSouth, WordUp, WordWest, WordEast,
+    WordNorth, NoWord, StaleMeat, ToyCar,
+    Bottle, Matches, WordSouth, GoldCoin,
+    Lamp, WordWest, Cheese, Pitchfork,
+    OldRadio, Oil, SilverCoin, WordUp,
+};
+const char *vocabText[VOCAB_SLOTS] = {
+    "xyzzy", "n", "key", "doll",
+    "d", "bookcase", "down", "candybar",
+    "book", "east", "", "flashlight",
+    "south", "up", "w", "e",
+    "north", "", "stale meat", "toy car",
+    "bottle", "matches", "s", "gold coin",
+    "lamp", "west", "cheese", "pitchfork",
+    "old radio", "oil", "silver coin", "u",
+};
+
 /* Clear the screen */
 void clearScreen()
 {
@@ -280,35 +333,45 @@ void clearScreen()
 #endif
 }
 
-/* Return 1 if carrying an item */
-number carryingItem(char *item)
+/* Return the word (in any case), or NoWord if it isn't in the vocabulary */
+number findWord(char *word)
 {
-    number i;
+    unsigned char a, b, c, slot;
+    char *p;
+
+    /* Hash as in tools/apple2/advhash.py, then check the one word that fits */
+    a = VOCAB_SEED;
+    b = 0;
+    for (p = word; (c = *p) != '\0'; ++p) {
+        c |= 0x20;
+        a = ((a << 3) | (a >> 5)) ^ c;
+        b = (b << 1) + c;
+    }
+    slot = (b + vocabDisp[a & (VOCAB_BUCKETS-1)]) & (VOCAB_SLOTS-1);
+    if (strcasecmp(word, vocabText[slot]))
+        return NoWord;
+    return vocabToken[slot];
+}
 
-    for (i = 0; i < MAXITEMS; i++) {
-        if ((Inventory[i] != 0) && (!strcasecmp(DescriptionOfItem[Inventory[i]], item)))
-            return 1;
-    }
-    return 0;
+/* Return the item named, or NoItem */
+number findItem(char *name)
+{
+    number word;
+
+    word = findWord(name);
+    return (word <= LastItem) ? word : NoItem;
 }
 
-/* Return 1 if item it at current location (not carried) */
-number itemIsHere(char *item)
+/* Return 1 if carrying an item */
+number carryingItem(number item)
 {
-    number i;
+    return (carriedItems[item >> 3] & BitMask[item & 7]) != 0;
+}
 
-    /* Find number of the item. */
-    for (i = 1; i <= LastItem; i++) {
-        if (!strcasecmp(item, DescriptionOfItem[i])) {
-            /* Found it, but is it here? */
-            if (locationOfItem[i] == currentLocation) {
-                return 1;
-            } else {
-                return 0;
-            }
-        }
-    }
-    return 0;
+/* Return 1 if item it at current location (not carried) */
+number itemIsHere(number item)
+{
+    return item != NoItem && locationOfItem[item] == currentLocation;
 }
 
 /* Inventory command */
@@ -376,7 +439,7 @@ void doQuit()
 /* Drop command */
 void doDrop()
 {
-    number i;
+    number i, n;
     char *sp;
     char *item;
 
@@ -388,18 +451,20 @@ void doDrop()
     }
 
     item = sp + 1;
+    n = findItem(item);
 
     /* See if we have this item */
-    for (i = 0; i < MAXITEMS; i++) {
-        if ((Inventory[i] != 0) && (!strcasecmp(DescriptionOfItem[Inventory[i]], item))) {
-            /* We have it. Add to location. */
-            locationOfItem[Inventory[i]] = currentLocation;
-            /* And remove from inventory */
-            Inventory[i] = 0;
-            printf("Dropped %s.\n", item);
-            ++turnsPlayed;
-            return;
-        }
+    if (carryingItem(n)) {
+        /* We have it. Add to location. */
+        locationOfItem[n] = currentLocation;
+        /* And remove from inventory */
+        for (i = 0; Inventory[i] != n; i++)
+            ;
+        Inventory[i] = 0;
+        carriedItems[n >> 3] &= ~BitMask[n & 7];
+        printf("Dropped %s.\n", item);
+        ++turnsPlayed;
+        return;
     }
     /* If here, don't have it. */
     printf("Not carrying %s.\n", item);
@@ -420,34 +485,31 @@ void doTake()
     }
 
     item = sp + 1;
+    i = findItem(item);
 
-    if (carryingItem(item)) {
+    if (carryingItem(i)) {
         printf("Already carrying it.\n");
         return;
     }
 
-    /* Find number of the item. */
-    for (i = 1; i <= LastItem; i++) {
-        if (!strcasecmp(item, DescriptionOfItem[i])) {
-            /* Found it, but is it here? */
-            if (locationOfItem[i] == currentLocation) {
-            /* It is here. Add to inventory. */
-            for (j = 0; j < MAXITEMS; j++) {
-                if (Inventory[j] == 0) {
-                    Inventory[j] = i;
-                    /* And remove from location. */
-                    locationOfItem[i] = 0;
-                    printf("Took %s.\n", item);
-                    ++turnsPlayed;
-                    return;
-                }
-            }
-
-            /* Reached maximum number of items to carry */
-            printf("You can't carry any more. Drop something.\n");
-            return;
+    /* Is it here? */
+    if (itemIsHere(i)) {
+        /* It is here. Add to inventory. */
+        for (j = 0; j < MAXITEMS; j++) {
+            if (Inventory[j] == 0) {
+                Inventory[j] = i;
+                carriedItems[i >> 3] |= BitMask[i & 7];
+                /* And remove from location. */
+                locationOfItem[i] = 0;
+                printf("Took %s.\n", item);
+                ++turnsPlayed;
+                return;
             }
         }
+
+        /* Reached maximum number of items to carry */
+        printf("You can't carry any more. Drop something.\n");
+        return;
     }
 
     /* If here, don't see it. */
@@ -505,7 +567,7 @@ void doGo()
 void doExamine()
 {
     char *sp;
-    char *item;
+    number word, item;
 
     /* Command line should be like "E[XAMINE] ITEM" Item name will be after after first space. */
     sp = strchr(buffer, ' ');
@@ -514,11 +576,12 @@ void doExamine()
         return;
     }
 
-    item = sp + 1;
+    word = findWord(sp + 1);
+    item = (word <= LastItem) ? word : NoItem;
     ++turnsPlayed;
 
     /* Examine bookcase - not an object */
-    if (!strcasecmp(item, "bookcase")) {
+    if (word == WordBookcase) {
         printf("You pull back a book and the bookcase\nopens up to reveal a secret room.\n");
         Move[17][North] = 18;
         return;
@@ -531,25 +594,25 @@ void doExamine()
     }
 
     /* Examine Book */
-    if (!strcasecmp(item, "book")) {
+    if (item == Book) {
         printf("It is a very old book entitled\n\"Apple 1 operation manual\".\n");
         return;
     }
 
     /* Examine Flashlight */
-    if (!strcasecmp(item, "flashlight")) {
+    if (item == Flashlight) {
         printf("It doesn't have any batteries.\n");
         return;
     }
 
     /* Examine toy car */
-    if (!strcasecmp(item, "toy car")) {
+    if (item == ToyCar) {
         printf("It is a nice toy car.\nYour grandson Matthew would like it.\n");
         return;
     }
 
     /* Examine old radio */
-    if (!strcasecmp(item, "old radio")) {
+    if (item == OldRadio) {
         printf("It is a 1940 Zenith 8-S-563 console\nwith an 8A02 chassis. You'd turn it on\nbut the electricity is off.\n");
         return;
     }
@@ -562,7 +625,7 @@ void doExamine()
 void doUse()
 {
     char *sp;
-    char *item;
+    number item;
 
     /* Command line should be like "U[SE] ITEM" Item name will be after after first space. */
     sp = strchr(buffer, ' ');
@@ -571,7 +634,7 @@ void doUse()
         return;
     }
 
-    item = sp + 1;
+    item = findItem(sp + 1);
 
     /* Make sure item is being carried or is in the current location */
     if (!carryingItem(item) && !itemIsHere(item)) {
@@ -582,29 +645,29 @@ void doUse()
     ++turnsPlayed;
 
     /* Use key */
-    if (!strcasecmp(item, "key") && (currentLocation == VacantRoom)) {
+    if ((item == Key) && (currentLocation == VacantRoom)) {
         printf("You insert the key in the door and it\nopens, revealing a tunnel.\n");
         Move[21][North] = 23;
         return;
     }
 
     /* Use pitchfork */
-    if (!strcasecmp(item, "pitchfork") && (currentLocation == WolfTree) && (wolfState == 0)) {
+    if ((item == Pitchfork) && (currentLocation == WolfTree) && (wolfState == 0)) {
         printf("You jab the wolf with the pitchfork.\nIt howls and runs away.\n");
         wolfState = 1;
         return;
     }
 
     /* Use toy car */
-    if (!strcasecmp(item, "toy car") && (currentLocation == WolfTree && wolfState == 1)) {
+    if ((item == ToyCar) && (currentLocation == WolfTree && wolfState == 1)) {
         printf("You show Matthew the toy car and he\ncomes down to take it. You take Matthew\nin your arms and carry him home.\n");
         wolfState = 2;
         return;
     }
 
     /* Use oil */
-    if (!strcasecmp(item, "oil")) {
-        if (carryingItem("lamp")) {
+    if (item == Oil) {
+        if (carryingItem(Lamp)) {
             printf("You fill the lamp with oil.\n");
             lampFilled = 1;
             return;
@@ -615,8 +678,8 @@ void doUse()
     }
 
     /* Use matches */
-    if (!strcasecmp(item, "matches")) {
-        if (carryingItem("lamp")) {
+    if (item == Matches) {
+        if (carryingItem(Lamp)) {
             if (lampFilled) {
                 printf("You light the lamp. You can see!\n");
                 lampLit = 1;
@@ -631,14 +694,14 @@ void doUse()
     }
 
     /* Use candybar */
-    if (!strcasecmp(item, "candybar")) {
+    if (item == Candybar) {
         printf("That hit the spot. You no longer feel\nhungry.\n");
         ateFood = 1;
         return;
     }
 
     /* Use bottle */
-    if (!strcasecmp(item, "bottle")) {
+    if (item == Bottle) {
         if (currentLocation == Cistern) {
             printf("You fill the bottle with water from the\ncistern and take a drink. You no longer\nfeel thirsty.\n");
             drankWater = 1;
@@ -650,7 +713,7 @@ void doUse()
     }
 
     /* Use stale meat */
-    if (!strcasecmp(item, "stale meat")) {
+    if (item == StaleMeat) {
         printf("The meat looked and tasted bad. You\nfeel very sick and pass out.\n");
         gameOver = 1;
         return;
@@ -677,7 +740,7 @@ void doActions()
         printf("It will be getting dark soon. You need\nsome kind of light or soon you won't\nbe able to see.\n");
     }
 
-    if ((turnsPlayed >= 60) && (!lampLit || (!itemIsHere("lamp") && !carryingItem("lamp")))) {
+    if ((turnsPlayed >= 60) && (!lampLit || (!itemIsHere(Lamp) && !carryingItem(Lamp)))) {
         printf("It is dark out and you have no light.\nYou stumble around for a while and\nthen fall, hit your head, and pass out.\n");
         gameOver = 1;
         return;
@@ -704,7 +767,7 @@ void doActions()
     }
 
     if (currentLocation == Tunnel) {
-        if (itemIsHere("cheese")) {
+        if (itemIsHere(Cheese)) {
             printf("The rats go after the cheese.\n");
         } else {
             if (ratAttack < 3) {
@@ -755,7 +818,9 @@ void initialize()
 
     /* Set inventory to default */
     memset(Inventory, 0, sizeof(Inventory[0])*MAXITEMS);
+    memset(carriedItems, 0, sizeof(carriedItems));
     Inventory[0] = Flashlight;
+    carriedItems[Flashlight >> 3] |= BitMask[Flashlight & 7];
 
     /* Put items in their default locations */
     locationOfItem[0]  = 0;                /* NoItem */
@@ -780,6 +845,8 @@ void initialize()
 /* Main program (obviously) */
 int main(void)
 {
+    number word;
+
     while (1) {
         initialize();
         clearScreen();
@@ -787,18 +854,14 @@ int main(void)
 
         while (!gameOver) {
             prompt();
+            word = findWord(buffer);
             if (buffer[0] == '\0') {
             } else if (tolower(buffer[0]) == 'h') {
                 doHelp();
             } else if (tolower(buffer[0]) == 'i') {
                 doInventory();
             } else if ((tolower(buffer[0]) == 'g')
-                       || !strcasecmp(buffer, "n") || !strcasecmp(buffer, "s")
-                       || !strcasecmp(buffer, "e") || !strcasecmp(buffer, "w")
-                       || !strcasecmp(buffer, "u") || !strcasecmp(buffer, "d")
-                       || !strcasecmp(buffer, "north") || !strcasecmp(buffer, "south")
-                       || !strcasecmp(buffer, "east") || !strcasecmp(buffer, "west")
-                       || !strcasecmp(buffer, "up") || !strcasecmp(buffer, "down")) {
+                       || (word >= WordNorth && word <= WordDown)) {
                 doGo();
             } else if (tolower(buffer[0]) == 'l') {
                 doLook();
@@ -812,7 +875,7 @@ int main(void)
                 doDrop();
             } else if (tolower(buffer[0]) == 'q') {
                 doQuit();
-            } else if (!strcasecmp(buffer, "xyzzy")) {
+            } else if (word == WordXyzzy) {
                 printf("Nice try, but that won't work here.\n");
             } else {
                 printf("I don't understand. Try 'help'.\n");
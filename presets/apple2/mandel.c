@@ -8,6 +8,7 @@
 
 
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <conio.h>
 #include <tgi.h>
@@ -43,6 +44,15 @@
 /* Use static local variables for speed */
 //#pragma static-locals (1);
 
+/* Use mandelbrot_fast() instead of mandelbrot() */
+#ifndef FAST_MANDEL
+#  define FAST_MANDEL   1
+#endif
+
+/* Work done by the renderer, for the stats */
+static unsigned pixels;
+static unsigned long iterations;
+
 
 
 void mandelbrot (signed short x1, signed short y1, signed short x2,
@@ -74,6 +84,8 @@ void mandelbrot (signed short x1, signed short y1, signed short x2,
                 i = (((signed long) r * i) >> (fpshift - 1)) + yy;
                 r = r1;
             }
+            ++pixels;
+            iterations += count;
             if (count == maxiterations) {
                 tgi_setcolor (0);
             } else {
@@ -89,6 +101,236 @@ void mandelbrot (signed short x1, signed short y1, signed short x2,
     }
 }
 
+#if FAST_MANDEL
+
+/*
+** Faster renderer:
+** - when the view is centered on the real axis, the rows are placed
+**   symmetrically around it and the bottom half mirrors the top half
+**   (so the rows land half a step away from where mandelbrot() puts them);
+** - rectangles whose border has a single escape count are filled
+**   without iterating their interior (Mariani-Silver subdivision);
+** - orbits that return to an earlier point are known to be inside
+**   (periodicity checking);
+** - squares come from a table, and 2*r*i from (r+i)^2 - r^2 - i^2,
+**   so there are no long multiplies (the results are exact).
+** Handles up to FAST_XRES x FAST_YRES pixels (a2_lo_tgi).
+*/
+
+#define FAST_XRES       40
+#define FAST_YRES       48
+
+/* x*x = sqrhi[x]*256 + sqrlo[x & 127], for 0 <= x < tofp(4) */
+static unsigned sqrhi[tofp (4)];
+static unsigned char sqrlo[128];
+
+/* Escape count of each pixel, or UNKNOWN */
+#define UNKNOWN         0xff
+static unsigned char dwell[FAST_YRES][FAST_XRES];
+
+/* Coordinates of each column and row */
+static signed short cre[FAST_XRES];
+static signed short cim[FAST_YRES];
+
+static unsigned char xres, yres, rows, ncolors;
+
+/* Rectangles left to do */
+#define MAXRECTS        32
+static unsigned char rx0[MAXRECTS], ry0[MAXRECTS];
+static unsigned char rx1[MAXRECTS], ry1[MAXRECTS];
+
+static void init_squares (void)
+{
+    register unsigned x, lo, hi;
+
+    /* (x+1)^2 = x^2 + 2x + 1 */
+    lo = hi = 0;
+    for (x = 0; x < tofp (4); ++x) {
+        sqrhi[x] = hi;
+        sqrlo[x & 127] = lo;
+        lo += x * 2 + 1;
+        hi += lo >> 8;
+        lo &= 0xff;
+    }
+}
+
+static unsigned char iterate (signed short xx, signed short yy)
+{
+    register signed short r, i;
+    register unsigned char count;
+    static unsigned x;
+    static signed short sr, si;
+    static unsigned char period;
+    static unsigned rr, ii;
+    static unsigned char rl, il;
+    static signed short lo;
+
+    r = i = sr = si = 0;
+    period = 1;
+    for (count = 0; count < maxiterations; ++count) {
+        /* |r| >= 2 or |i| >= 2? */
+        if ((unsigned) (r + tofp (2) - 1) >= tofp (4) - 1 ||
+            (unsigned) (i + tofp (2) - 1) >= tofp (4) - 1) {
+            break;
+        }
+        /* r*r and i*i, divided by 256 */
+        x = r < 0 ? -r : r;
+        rr = sqrhi[x];
+        rl = sqrlo[x & 127];
+        x = i < 0 ? -i : i;
+        ii = sqrhi[x];
+        il = sqrlo[x & 127];
+        /* 2*r*i = (r+i)^2 - r*r - i*i, keeping the carry from the low bytes */
+        x = r + i;
+        if ((signed short) x < 0) {
+            x = -x;
+        }
+        lo = sqrlo[x & 127];
+        lo -= rl;
+        lo -= il;
+        i = ((signed short) (sqrhi[x] - rr - ii + (lo >> 8)) >> 2) + yy;
+        r = ((rr >> 2) - (ii >> 2)) + xx;
+        /* back where we were? then we never escape */
+        if (r == sr && i == si) {
+            count = maxiterations;
+            break;
+        }
+        if (count == period) {
+            sr = r;
+            si = i;
+            period <<= 1;
+        }
+    }
+    ++pixels;
+    iterations += count;
+    return count;
+}
+
+static void setcolor (unsigned char count)
+{
+    if (count == maxiterations) {
+        tgi_setcolor (0);
+    } else if (ncolors == 2) {
+        tgi_setcolor (1);
+    } else {
+        tgi_setcolor (count % ncolors);
+    }
+}
+
+static unsigned char pixel (unsigned char x, unsigned char y)
+{
+    register unsigned char d;
+
+    d = dwell[y][x];
+    if (d == UNKNOWN) {
+        d = dwell[y][x] = iterate (cre[x], cim[y]);
+        setcolor (d);
+        tgi_setpixel (x, y);
+        if (rows != yres) {
+            tgi_setpixel (x, yres - 1 - y);
+        }
+    }
+    return d;
+}
+
+static void push_rect (unsigned char n, unsigned char x0, unsigned char y0,
+                       unsigned char x1, unsigned char y1)
+{
+    rx0[n] = x0;
+    ry0[n] = y0;
+    rx1[n] = x1;
+    ry1[n] = y1;
+}
+
+void mandelbrot_fast (signed short x1, signed short y1, signed short x2,
+                      signed short y2)
+{
+    register unsigned char x, y, d;
+    static unsigned char x0, y0, xe, ye, mx, my, n, same;
+    static signed short xs, ys;
+
+    xres = SCREEN_X;
+    yres = SCREEN_Y;
+    ncolors = MAXCOL;
+    if (xres > FAST_XRES || yres > FAST_YRES) {
+        mandelbrot (x1, y1, x2, y2);
+        return;
+    }
+    if (!sqrhi[tofp (4) - 1]) {
+        init_squares ();
+    }
+    memset (dwell, UNKNOWN, sizeof (dwell));
+
+    /* Calc stepwidth and coordinates */
+    xs = ((x2 - x1) / xres);
+    ys = ((y2 - y1) / yres);
+    for (x = 0; x < xres; ++x) {
+        cre[x] = x1 + xs * (x + 1);
+    }
+    if (y1 + y2 == 0) {
+        /* rows symmetric around the real axis, only do the top half */
+        rows = (yres + 1) / 2;
+        for (y = 0; y < yres; ++y) {
+            cim[y] = (signed short) (y * 2 + 1 - yres) * ys / 2;
+        }
+    } else {
+        rows = yres;
+        for (y = 0; y < yres; ++y) {
+            cim[y] = y1 + ys * (y + 1);
+        }
+    }
+
+    push_rect (0, 0, 0, xres - 1, rows - 1);
+    n = 1;
+    while (n) {
+        --n;
+        x0 = rx0[n];
+        y0 = ry0[n];
+        xe = rx1[n];
+        ye = ry1[n];
+        /* Trace the border */
+        d = pixel (x0, y0);
+        same = 1;
+        for (x = x0; x <= xe; ++x) {
+            if (pixel (x, y0) != d || pixel (x, ye) != d) {
+                same = 0;
+            }
+        }
+        for (y = y0 + 1; y < ye; ++y) {
+            if (pixel (x0, y) != d || pixel (xe, y) != d) {
+                same = 0;
+            }
+        }
+        if (xe - x0 < 2 || ye - y0 < 2) {
+            /* no inside */
+        } else if (same) {
+            /* Fill the inside with the border color */
+            setcolor (d);
+            tgi_bar (x0 + 1, y0 + 1, xe - 1, ye - 1);
+            if (rows != yres) {
+                tgi_bar (x0 + 1, yres - ye, xe - 1, yres - 2 - y0);
+            }
+        } else if (xe - x0 < 4 || ye - y0 < 4) {
+            /* Too small to split, do each pixel */
+            for (y = y0 + 1; y < ye; ++y) {
+                for (x = x0 + 1; x < xe; ++x) {
+                    pixel (x, y);
+                }
+            }
+        } else {
+            /* Split in four, sharing the middle lines */
+            mx = (x0 + xe) / 2;
+            my = (y0 + ye) / 2;
+            push_rect (n++, x0, y0, mx, my);
+            push_rect (n++, mx, y0, xe, my);
+            push_rect (n++, x0, my, mx, ye);
+            push_rect (n++, mx, my, xe, ye);
+        }
+    }
+}
+
+#endif
+
 int main (void)
 {
     clock_t t;
@@ -124,7 +366,11 @@ int main (void)
     t = clock ();
 
     /* Calc mandelbrot set */
+#if FAST_MANDEL
+    mandelbrot_fast (tofp (-2), tofp (-2), tofp (2), tofp (2));
+#else
     mandelbrot (tofp (-2), tofp (-2), tofp (2), tofp (2));
+#endif
 
     t = clock () - t;
 
@@ -141,6 +387,8 @@ int main (void)
 
     /* Output stats */
     cprintf ("time  : %lu.%us\n\r", sec, sec10);
+    cprintf ("pixels: %u\n\r", pixels);
+    cprintf ("iters : %lu\n\r", iterations);
 
     if (doesclrscrafterexit ()) {
         /* Wait for a key, then end */
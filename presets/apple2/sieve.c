@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <ctype.h>
 #include <time.h>
+#include <string.h>
 #include <conio.h>
 
 /* Workaround missing clock stuff */
@@ -15,6 +16,16 @@
 #  define CLOCKS_PER_SEC        1
 #endif
 
+/* The NES has no stdio or keyboard: print with conio, and skip the list */
+#ifdef __NES__
+#  define printf                cprintf
+#  define NL                    "\r\n"
+#  define HAVE_KEYBOARD         0
+#else
+#  define NL                    "\n"
+#  define HAVE_KEYBOARD         1
+#endif
+
 /*****************************************************************************/
 /*                                   Data                                    */
 /*****************************************************************************/
@@ -22,19 +33,73 @@
 #define COUNT           4096           /* Up to what number? */
 #define SQRT_COUNT      64             /* Sqrt of COUNT */
 
+/* Use the bit-packed sieve instead of one byte per number */
+#ifndef PACKED_SIEVE
+#  define PACKED_SIEVE  0
+#endif
+
+/* Times to run the sieve, for clocks that tick slowly */
+#ifndef REPEAT
+#  define REPEAT        1
+#endif
+
+#if PACKED_SIEVE
+
+/* One bit per odd number: bit n of the array stands for 2n+1,
+** and is set when that number is not a prime.
+*/
+static unsigned char Sieve[COUNT/16];
+
+static const unsigned char BitMask[8] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
+/* Wheel of 3, 5 and 7: their odd multiples (and 1) repeat every
+** 3*5*7 = 105 bytes, so the sieve starts as copies of this pattern.
+*/
+#define WHEEL           105
+static const unsigned char Wheel[WHEEL] = {
+    0x9E, 0x34, 0x4B, 0x9B, 0x65, 0xED, 0x92, 0x6E, 0x4D, 0xB3, 0xA5, 0x59, 0xF2, 0x3C, 0x69,
+    0x96, 0x36, 0xCB, 0xDA, 0x25, 0xDD, 0x9A, 0x66, 0x4B, 0xB3, 0xE4, 0x79, 0xD2, 0x2C, 0x6D,
+    0x96, 0xB5, 0x4B, 0xBA, 0x35, 0xCD, 0x96, 0x66, 0xC9, 0xF3, 0xA4, 0x59, 0xDA, 0x2C, 0x6B,
+    0x97, 0x74, 0x6B, 0x9A, 0x2D, 0xCD, 0x92, 0xE7, 0x49, 0xB3, 0xB4, 0x59, 0xD6, 0x2E, 0xE9,
+    0xD6, 0x34, 0x5B, 0x9A, 0x25, 0xCF, 0x93, 0x66, 0x69, 0xB3, 0xAC, 0x5D, 0xD2, 0xAD, 0x69,
+    0xB6, 0x34, 0x4B, 0x9E, 0x27, 0xCD, 0xD2, 0x66, 0x59, 0xBB, 0xA4, 0x5B, 0xD3, 0x6C, 0x69,
+    0x96, 0x3C, 0x4F, 0x9A, 0xA5, 0xCD, 0xB2, 0x76, 0x49, 0xB7, 0xA6, 0xD9, 0xD2, 0x2C, 0x79,
+};
+
+/* Strikes for one prime P repeat every P bytes: 8 bits, each at a
+** byte offset from the start of the group.
+*/
+static unsigned char StrikeOfs[8];
+static unsigned char StrikeMask[8];
+
+#define STRIKE(k)       S[StrikeOfs[k]] |= StrikeMask[k]
+
+#define IS_PRIME(n)     ((n) == 2 || (((n) & 1) && \
+                         !(Sieve[(n) >> 4] & BitMask[((n) >> 1) & 7])))
+
+#else
+
 static unsigned char Sieve[COUNT];
 
+#define IS_PRIME(n)     (Sieve[n] == 0)
+
+#endif
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
 
 #pragma static-locals(1);
 
+#if HAVE_KEYBOARD
 static char ReadUpperKey (void)
 /* Read a key from console, convert to upper case and return */
 {
     return toupper (cgetc ());
 }
+#endif
 
 int main (void)
 {
@@ -47,29 +112,75 @@ int main (void)
     register unsigned char* S;
     register unsigned       I;
     register unsigned       J;
+    unsigned                R;
+    unsigned                Sum;
+#if PACKED_SIEVE
+    unsigned char           K;
+    unsigned char*          E;
+#endif
 
     /* Output a header */
-    printf ("Sieve benchmark - calculating primes\n");
-    printf ("between 2 and %u\n", COUNT);
-    printf ("Please wait patiently ...\n");
+    printf ("Sieve benchmark - calculating primes" NL);
+    printf ("between 2 and %u" NL, COUNT);
+    printf ("Please wait patiently ..." NL);
 
     /* Read the clock */
     Ticks = clock();
 
     /* Execute the sieve */
-    I = 2;
-    while (I < SQRT_COUNT) {
-        if (Sieve[I] == 0) {
-            /* Prime number - mark multiples */
-            J = I*2;
-            S = &Sieve[J];
-            while (J < COUNT) {
-                *S = 1;
-                S += I;
-                J += I;
+    for (R = 0; R < REPEAT; ++R) {
+#if PACKED_SIEVE
+        /* Lay the wheel over the sieve */
+        for (I = 0; I < sizeof (Sieve); I += WHEEL) {
+            memcpy (&Sieve[I], Wheel,
+                    sizeof (Sieve) - I < WHEEL ? sizeof (Sieve) - I : WHEEL);
+        }
+        /* 1 is not a prime, but 3, 5 and 7 are */
+        Sieve[0] = (Sieve[0] | 0x01) & ~0x0E;
+
+        /* Strike odd multiples of the other primes, from I*I up */
+        for (I = 11; I < SQRT_COUNT; I += 2) {
+            if (IS_PRIME (I)) {
+                /* Offsets and masks of 8 strikes, which span I bytes */
+                J = (I*I) >> 1;
+                for (K = 0; K < 8; ++K) {
+                    StrikeOfs[K] = (J >> 3) - ((I*I) >> 4);
+                    StrikeMask[K] = BitMask[J & 7];
+                    J += I;
+                }
+                /* Strike them I bytes at a time, then the partial group */
+                S = &Sieve[(I*I) >> 4];
+                E = Sieve + sizeof (Sieve) - I;
+                while (S <= E) {
+                    STRIKE (0); STRIKE (1); STRIKE (2); STRIKE (3);
+                    STRIKE (4); STRIKE (5); STRIKE (6); STRIKE (7);
+                    S += I;
+                }
+                E += I;
+                for (K = 0; K < 8 && S + StrikeOfs[K] < E; ++K) {
+                    STRIKE (K);
+                }
+            }
+        }
+#else
+        if (R) {
+            memset (Sieve, 0, sizeof (Sieve));
+        }
+        I = 2;
+        while (I < SQRT_COUNT) {
+            if (Sieve[I] == 0) {
+                /* Prime number - mark multiples */
+                J = I*2;
+                S = &Sieve[J];
+                while (J < COUNT) {
+                    *S = 1;
+                    S += I;
+                    J += I;
+                }
             }
+            ++I;
         }
-        ++I;
+#endif
     }
 
     /* Calculate the time used */
@@ -77,8 +188,19 @@ int main (void)
     Sec = (unsigned) (Ticks / CLOCKS_PER_SEC);
     Milli = ((Ticks % CLOCKS_PER_SEC) * 1000) / CLOCKS_PER_SEC;
 
-    /* Print the time used */
-    printf ("Time used: %u.%03u seconds\n", Sec, Milli);
+    /* Print the time used, and a result to check against other builds */
+    printf ("Time used: %u.%03u seconds" NL, Sec, Milli);
+    J = Sum = 0;
+    for (I = 2; I < COUNT; ++I) {
+        if (IS_PRIME (I)) {
+            ++J;
+            Sum += I;
+        }
+    }
+    printf ("%u primes below %u" NL, J, COUNT);
+    printf ("Checksum: %04X" NL, Sum);
+
+#if HAVE_KEYBOARD
     printf ("Q to quit, any other key for list\n");
 
     /* Wait for a key and print the list if not 'Q' */
@@ -86,7 +208,7 @@ int main (void)
         /* Print the result */
         J = 0;
         for (I = 2; I < COUNT; ++I) {
-            if (Sieve[I] == 0) {
+            if (IS_PRIME (I)) {
                 printf ("%4d\n", I);
                 if (++J == 23) {
                     printf ("Q to quit, any other key continues\n");
@@ -101,6 +223,7 @@ int main (void)
             }
         }
     }
+#endif
 
     return EXIT_SUCCESS;
 }
@@ -76,6 +76,11 @@ Players can be the computer.
 /* Number of dice rolls. */
 #define MAXROLLS 3
 
+/* Computer player looks up expected values instead of following rules of thumb. */
+#ifndef OPTIMAL_AI
+#define OPTIMAL_AI 1
+#endif
+
 /* VARIABLES */
 
 /* Number of human players. */
@@ -406,6 +411,8 @@ bool haveYum()
     return true;
 }
 
+#if !OPTIMAL_AI
+
 /* Determine if we have four the same. If so, return the number we have and set d to the dice that is wrong. */
 int haveFourTheSame(int *d)
 {
@@ -591,6 +598,8 @@ bool keepHighest()
     return false;
 }
 
+#endif
+
 /* Display dice being kept and being rolled again. */
 void displayDiceRolledAgain()
 {
@@ -822,8 +831,7 @@ void playCategory(int category)
         scoreSheet[player][category] = haveHighStraight() ? 20 : 0;
         break;
     case 10: /* Low score. Must be 21 or more and less than high score. */
-        scoreSheet[player][category] = (sum() >= 21) ? sum() : 0;
-        if ((sum() >= 21) && ((scoreSheet[player][10] == UNSET) || (sum() < scoreSheet[player][11]))) {
+        if ((sum() >= 21) && ((scoreSheet[player][11] == UNSET) || (sum() < scoreSheet[player][11]))) {
             scoreSheet[player][category] = sum();
         } else {
             scoreSheet[player][category] = 0;
@@ -922,6 +930,533 @@ void displayWinner()
     }
 }
 
+#if OPTIMAL_AI
+
+/*
+ * Expected-value computer player. The tables (from tools/apple2/yumtab.py)
+ * give the score to expect from the categories still open when the rest
+ * of the game is played well, and number each multiset of dice so that
+ * adding a die is a lookup. At the first roll of its turn the computer
+ * works out from them what every multiset of kept dice is worth with one
+ * or two rolls left; after that each choice is a few lookups. The
+ * upper-section bonus is counted when a category reaches it.
+ *
+ * The tables below are printed by: python3 tools/apple2/yumtab.py
+ */
+
+#ifdef __APPLE2__
+/* The tables and the code go in the 6K of low memory below the hires page. */
+#pragma code-name (push, "LOWCODE")
+#pragma rodata-name (push, "LOWCODE")
+#endif
+
+/* generated by tools/apple2/yumtab.py -- do not edit */
+/* expected score 161.7, table off by at most 2.1 points */
+#define VALUE_SCALE 2
+#define SMALL_SETS 210
+#define ROLL_SETS 252
+const unsigned char setBase[6] = { 0, 1, 7, 28, 84, 210 };
+const unsigned char diceNext[1260] = {
+  0,1,2,3,4,5,0,1,2,3,4,5,1,6,7,8,9,10,
+  2,7,11,12,13,14,3,8,12,15,16,17,4,9,13,16,18,19,
+  5,10,14,17,19,20,0,1,2,3,4,5,1,6,7,8,9,10,
+  2,7,11,12,13,14,3,8,12,15,16,17,4,9,13,16,18,19,
+  5,10,14,17,19,20,6,21,22,23,24,25,7,22,26,27,28,29,
+  8,23,27,30,31,32,9,24,28,31,33,34,10,25,29,32,34,35,
+  11,26,36,37,38,39,12,27,37,40,41,42,13,28,38,41,43,44,
+  14,29,39,42,44,45,15,30,40,46,47,48,16,31,41,47,49,50,
+  17,32,42,48,50,51,18,33,43,49,52,53,19,34,44,50,53,54,
+  20,35,45,51,54,55,0,1,2,3,4,5,1,6,7,8,9,10,
+  2,7,11,12,13,14,3,8,12,15,16,17,4,9,13,16,18,19,
+  5,10,14,17,19,20,6,21,22,23,24,25,7,22,26,27,28,29,
+  8,23,27,30,31,32,9,24,28,31,33,34,10,25,29,32,34,35,
+  11,26,36,37,38,39,12,27,37,40,41,42,13,28,38,41,43,44,
+  14,29,39,42,44,45,15,30,40,46,47,48,16,31,41,47,49,50,
+  17,32,42,48,50,51,18,33,43,49,52,53,19,34,44,50,53,54,
+  20,35,45,51,54,55,21,56,57,58,59,60,22,57,61,62,63,64,
+  23,58,62,65,66,67,24,59,63,66,68,69,25,60,64,67,69,70,
+  26,61,71,72,73,74,27,62,72,75,76,77,28,63,73,76,78,79,
+  29,64,74,77,79,80,30,65,75,81,82,83,31,66,76,82,84,85,
+  32,67,77,83,85,86,33,68,78,84,87,88,34,69,79,85,88,89,
+  35,70,80,86,89,90,36,71,91,92,93,94,37,72,92,95,96,97,
+  38,73,93,96,98,99,39,74,94,97,99,100,40,75,95,101,102,103,
+  41,76,96,102,104,105,42,77,97,103,105,106,43,78,98,104,107,108,
+  44,79,99,105,108,109,45,80,100,106,109,110,46,81,101,111,112,113,
+  47,82,102,112,114,115,48,83,103,113,115,116,49,84,104,114,117,118,
+  50,85,105,115,118,119,51,86,106,116,119,120,52,87,107,117,121,122,
+  53,88,108,118,122,123,54,89,109,119,123,124,55,90,110,120,124,125,
+  0,1,2,3,4,5,1,6,7,8,9,10,2,7,11,12,13,14,
+  3,8,12,15,16,17,4,9,13,16,18,19,5,10,14,17,19,20,
+  6,21,22,23,24,25,7,22,26,27,28,29,8,23,27,30,31,32,
+  9,24,28,31,33,34,10,25,29,32,34,35,11,26,36,37,38,39,
+  12,27,37,40,41,42,13,28,38,41,43,44,14,29,39,42,44,45,
+  15,30,40,46,47,48,16,31,41,47,49,50,17,32,42,48,50,51,
+  18,33,43,49,52,53,19,34,44,50,53,54,20,35,45,51,54,55,
+  21,56,57,58,59,60,22,57,61,62,63,64,23,58,62,65,66,67,
+  24,59,63,66,68,69,25,60,64,67,69,70,26,61,71,72,73,74,
+  27,62,72,75,76,77,28,63,73,76,78,79,29,64,74,77,79,80,
+  30,65,75,81,82,83,31,66,76,82,84,85,32,67,77,83,85,86,
+  33,68,78,84,87,88,34,69,79,85,88,89,35,70,80,86,89,90,
+  36,71,91,92,93,94,37,72,92,95,96,97,38,73,93,96,98,99,
+  39,74,94,97,99,100,40,75,95,101,102,103,41,76,96,102,104,105,
+  42,77,97,103,105,106,43,78,98,104,107,108,44,79,99,105,108,109,
+  45,80,100,106,109,110,46,81,101,111,112,113,47,82,102,112,114,115,
+  48,83,103,113,115,116,49,84,104,114,117,118,50,85,105,115,118,119,
+  51,86,106,116,119,120,52,87,107,117,121,122,53,88,108,118,122,123,
+  54,89,109,119,123,124,55,90,110,120,124,125,56,126,127,128,129,130,
+  57,127,131,132,133,134,58,128,132,135,136,137,59,129,133,136,138,139,
+  60,130,134,137,139,140,61,131,141,142,143,144,62,132,142,145,146,147,
+  63,133,143,146,148,149,64,134,144,147,149,150,65,135,145,151,152,153,
+  66,136,146,152,154,155,67,137,147,153,155,156,68,138,148,154,157,158,
+  69,139,149,155,158,159,70,140,150,156,159,160,71,141,161,162,163,164,
+  72,142,162,165,166,167,73,143,163,166,168,169,74,144,164,167,169,170,
+  75,145,165,171,172,173,76,146,166,172,174,175,77,147,167,173,175,176,
+  78,148,168,174,177,178,79,149,169,175,178,179,80,150,170,176,179,180,
+  81,151,171,181,182,183,82,152,172,182,184,185,83,153,173,183,185,186,
+  84,154,174,184,187,188,85,155,175,185,188,189,86,156,176,186,189,190,
+  87,157,177,187,191,192,88,158,178,188,192,193,89,159,179,189,193,194,
+  90,160,180,190,194,195,91,161,196,197,198,199,92,162,197,200,201,202,
+  93,163,198,201,203,204,94,164,199,202,204,205,95,165,200,206,207,208,
+  96,166,201,207,209,210,97,167,202,208,210,211,98,168,203,209,212,213,
+  99,169,204,210,213,214,100,170,205,211,214,215,101,171,206,216,217,218,
+  102,172,207,217,219,220,103,173,208,218,220,221,104,174,209,219,222,223,
+  105,175,210,220,223,224,106,176,211,221,224,225,107,177,212,222,226,227,
+  108,178,213,223,227,228,109,179,214,224,228,229,110,180,215,225,229,230,
+  111,181,216,231,232,233,112,182,217,232,234,235,113,183,218,233,235,236,
+  114,184,219,234,237,238,115,185,220,235,238,239,116,186,221,236,239,240,
+  117,187,222,237,241,242,118,188,223,238,242,243,119,189,224,239,243,244,
+  120,190,225,240,244,245,121,191,226,241,246,247,122,192,227,242,247,248,
+  123,193,228,243,248,249,124,194,229,244,249,250,125,195,230,245,250,251,
+};
+const unsigned char upperValue[448] = {
+  155,152,149,144,139,132,118,141,138,135,132,128,121,109,
+  137,134,131,128,123,117,104,122,120,118,115,111,106,95,
+  132,129,126,123,118,112,99,118,115,113,110,106,101,90,
+  113,111,109,106,102,97,85,99,97,95,93,90,85,75,
+  126,124,121,117,113,106,94,112,110,108,105,101,96,85,
+  108,106,104,101,97,91,80,94,92,90,88,85,80,71,
+  103,101,99,96,92,86,75,89,87,85,83,80,76,66,
+  85,83,81,79,76,72,62,70,69,67,66,63,60,52,
+  121,118,115,112,107,101,88,107,105,102,99,96,90,79,
+  103,100,98,95,92,86,75,88,87,85,83,80,75,66,
+  98,96,93,90,87,81,70,84,82,80,78,75,70,61,
+  79,78,76,74,71,66,56,65,64,62,61,59,55,47,
+  92,90,88,85,81,75,64,78,77,75,73,70,65,56,
+  74,73,71,69,66,61,51,60,59,57,56,54,50,43,
+  69,68,66,64,61,56,46,55,54,53,51,49,46,38,
+  51,50,49,47,45,42,34,36,36,35,34,33,31,25,
+  116,113,110,106,102,95,82,102,100,98,95,91,85,74,
+  98,96,93,90,86,81,69,84,82,80,78,75,70,60,
+  93,91,88,85,81,76,64,79,78,76,73,70,66,56,
+  75,73,71,69,66,61,51,61,60,58,57,54,51,42,
+  88,85,83,80,76,70,59,74,72,70,68,65,60,51,
+  70,68,66,64,61,56,46,56,55,53,52,49,46,38,
+  65,63,61,59,56,51,41,51,50,49,47,45,41,33,
+  47,46,44,43,41,37,29,32,32,31,30,29,27,21,
+  82,80,77,74,70,65,53,69,67,65,63,60,55,45,
+  64,63,61,59,56,51,41,51,50,48,47,44,41,33,
+  59,58,56,54,51,46,36,46,45,44,42,40,36,28,
+  42,41,39,38,36,32,24,28,27,27,26,24,22,17,
+  54,52,51,48,45,41,30,41,40,38,37,35,31,24,
+  36,35,34,33,31,27,19,23,22,22,21,20,18,13,
+  32,31,30,28,26,23,14,18,18,17,16,15,14,8,
+  14,14,13,13,12,10,4,0,0,0,0,0,0,0,
+};
+const unsigned char lowerValue[448] = {
+  168,168,168,168,168,168,168,154,154,153,153,153,153,152,
+  147,147,147,147,147,148,148,134,134,134,134,134,133,133,
+  118,117,117,116,116,116,115,104,104,103,102,102,101,100,
+  98,98,97,97,97,97,97,87,86,85,85,84,83,82,
+  118,118,117,117,116,116,116,104,104,103,103,103,102,102,
+  98,98,98,98,98,98,98,87,86,86,85,85,84,84,
+  66,66,64,64,63,62,62,54,53,52,51,49,48,48,
+  49,48,47,46,46,45,45,38,37,36,35,34,33,32,
+  124,124,124,125,125,126,128,110,110,110,111,112,112,114,
+  103,104,104,105,106,107,109,92,92,92,93,94,95,96,
+  74,74,74,74,75,75,77,62,61,61,61,62,63,64,
+  56,55,56,56,57,59,61,45,45,45,45,46,47,49,
+  74,74,74,75,75,76,78,62,62,62,62,62,64,65,
+  56,56,56,57,58,59,61,46,45,46,46,47,48,50,
+  24,23,23,23,23,24,26,13,12,12,12,12,13,15,
+  8,7,7,8,8,10,12,0,0,0,0,0,0,3,
+  153,154,154,154,154,154,153,139,140,140,140,139,138,136,
+  132,134,134,135,135,134,134,122,122,122,122,121,118,113,
+  103,104,104,104,103,102,101,91,91,91,90,89,87,85,
+  86,86,86,86,85,84,83,75,75,75,74,72,69,65,
+  104,104,104,104,104,103,102,92,91,91,91,90,88,87,
+  86,86,86,86,86,85,85,76,76,75,75,73,71,68,
+  54,53,53,52,51,49,48,43,42,41,40,38,36,34,
+  38,38,37,36,35,34,33,30,29,28,27,25,21,18,
+  110,111,112,113,114,114,115,98,98,99,99,100,101,101,
+  91,92,93,94,96,97,98,81,82,83,84,84,84,81,
+  62,62,63,63,64,65,66,51,51,52,52,52,53,53,
+  45,46,47,48,49,50,51,38,38,39,39,40,39,37,
+  63,63,63,64,65,66,67,51,52,52,53,53,54,55,
+  46,46,47,48,49,51,53,38,39,39,40,41,41,41,
+  14,14,14,14,15,15,17,5,5,5,6,6,6,8,
+  1,1,1,2,3,4,6,0,0,0,0,0,0,0,
+};
+
+/* Values below are in 1/EV_SCALE points. */
+#define EV_SCALE 16
+
+/*
+ * Value of keeping each multiset of dice and rolling the others, with
+ * one and two rolls left. Worked out at the first roll of each turn.
+ */
+static unsigned oneRoll[SMALL_SETS + ROLL_SETS];
+static unsigned twoRolls[SMALL_SETS + ROLL_SETS];
+
+/* Value of the rest of the game after playing each category, or CLOSED. */
+#define CLOSED 0xffff
+static unsigned afterPlaying[MAXCATEGORY];
+
+/* The best category to play dice that score nothing in. */
+static unsigned nothingValue;
+static unsigned char nothingCategory;
+
+/*
+ * Points in an upper category that reach the bonus (or NOBONUS), and
+ * the totals that can be played as low score and high score.
+ */
+#define NOBONUS 0xff
+static unsigned char bonusAt;
+static unsigned char lowBelow;
+static unsigned char highFrom;
+
+/* Dice being scored: how many show each number, their points and sum. */
+static unsigned char count[7];
+static unsigned char points[7];
+static unsigned char total;
+
+/* Best category found by bestScore(), and its value. */
+static unsigned char bestCategory;
+static unsigned bestValue;
+
+/* Expected score from the categories not in used (a mask from yumtab.py). */
+unsigned tableValue(unsigned used)
+{
+    unsigned char upper, lower, upperBits, lowerBits, i;
+
+    upper = used & 63;
+    lower = used >> 6;
+    upperBits = lowerBits = 0;
+    for (i = 1; i < 64; i <<= 1) {
+        if (upper & i) {
+            ++upperBits;
+        }
+        if (lower & i) {
+            ++lowerBits;
+        }
+    }
+    return (upperValue[upper * 7 + lowerBits] + lowerValue[lower * 7 + upperBits]) * (EV_SCALE / VALUE_SCALE);
+}
+
+/* Find the categories the current player can still play. */
+void planCategories()
+{
+    int c, bonusNeeded, lowScore, highScore;
+    unsigned used, mask;
+
+    used = 0;
+    mask = 1;
+    bonusNeeded = 63;
+    for (c = 0; c < MAXCATEGORY; c++) {
+        afterPlaying[c] = CLOSED;
+        /* Skip sub-total, bonus and total. */
+        if ((c == 6) || (c == 7) || (c == 14)) {
+            continue;
+        }
+        if (scoreSheet[player][c] != UNSET) {
+            used |= mask;
+            if (c < 6) {
+                bonusNeeded -= scoreSheet[player][c];
+            }
+        }
+        mask <<= 1;
+    }
+
+    nothingValue = 0;
+    mask = 1;
+    for (c = 0; c < MAXCATEGORY - 1; c++) {
+        if ((c == 6) || (c == 7)) {
+            continue;
+        }
+        if (!(used & mask)) {
+            afterPlaying[c] = tableValue(used | mask);
+            if (afterPlaying[c] >= nothingValue) {
+                nothingValue = afterPlaying[c];
+                nothingCategory = c;
+            }
+        }
+        mask <<= 1;
+    }
+    bonusAt = (bonusNeeded > 0 && bonusNeeded <= 30) ? bonusNeeded : NOBONUS;
+
+    /* Low score must be less than high score, high score more than low score. */
+    lowScore = scoreSheet[player][10];
+    highScore = scoreSheet[player][11];
+    lowBelow = (highScore == UNSET) ? 0xff : highScore;
+    highFrom = (lowScore < 22) ? 22 : lowScore + 1;
+}
+
+/* Categories the dice being scored get points in, and the points. */
+static unsigned char numScoring;
+static unsigned char scoringCategory[8];
+static unsigned char scoringPoints[8];
+
+#define SCORES(c, s) (scoringCategory[numScoring] = (c), scoringPoints[numScoring++] = (s))
+
+/*
+ * Value of the dice in count[], points[] and total when played in the
+ * best open category, which is left in bestCategory. Scores like
+ * playCategory(), but only tries the categories the dice get points in.
+ */
+unsigned bestScore()
+{
+    static unsigned char i, c, s, n, most, pair;
+    static unsigned v;
+
+    numScoring = 0;
+    most = pair = 0;
+    for (c = 1; c <= 6; c++) {
+        n = count[c];
+        if (n) {
+            if (n > most) {
+                most = n;
+            }
+            if (n == 2) {
+                pair = 1;
+            }
+            SCORES(c - 1, points[c]);
+        }
+    }
+
+    /* Low and high score. */
+    if (total >= 21 && total < lowBelow) {
+        SCORES(10, total);
+    }
+    if (total >= highFrom) {
+        SCORES(11, total);
+    }
+
+    /* Low and high straight. */
+    if (most == 1) {
+        if (!count[6]) {
+            SCORES(8, 15);
+        } else if (!count[1]) {
+            SCORES(9, 20);
+        }
+    }
+
+    /* Full house and YUM. */
+    if (most == 5 || (most == 3 && pair)) {
+        SCORES(12, 25);
+    }
+    if (most == 5) {
+        SCORES(13, 30);
+    }
+
+    bestValue = nothingValue;
+    bestCategory = nothingCategory;
+    for (i = 0; i < numScoring; i++) {
+        c = scoringCategory[i];
+        v = afterPlaying[c];
+        if (v == CLOSED) {
+            continue;
+        }
+        s = scoringPoints[i];
+        v += s * EV_SCALE;
+        if (c < 6 && s >= bonusAt) {
+            v += 25 * EV_SCALE;
+        }
+        if (v > bestValue) {
+            bestValue = v;
+            bestCategory = c;
+        }
+    }
+    return bestValue;
+}
+
+/*
+ * Value of each of the five dice multisets as the last roll, going
+ * through the sorted dice in order (11111, 11112, ... 66666).
+ */
+void scoreRolls()
+{
+    static unsigned char a, b, c, d, e;
+    static unsigned *value;
+
+    value = oneRoll + SMALL_SETS;
+    memset(count, 0, sizeof(count));
+    memset(points, 0, sizeof(points));
+    for (a = 1; a <= 6; a++) {
+        ++count[a];
+        points[a] += a;
+        for (b = a; b <= 6; b++) {
+            ++count[b];
+            points[b] += b;
+            for (c = b; c <= 6; c++) {
+                ++count[c];
+                points[c] += c;
+                for (d = c; d <= 6; d++) {
+                    ++count[d];
+                    points[d] += d;
+                    for (e = d; e <= 6; e++) {
+                        ++count[e];
+                        points[e] += e;
+                        total = a + b + c + d + e;
+                        *value++ = bestScore();
+                        --count[e];
+                        points[e] -= e;
+                    }
+                    --count[d];
+                    points[d] -= d;
+                }
+                --count[c];
+                points[c] -= c;
+            }
+            --count[b];
+            points[b] -= b;
+        }
+        --count[a];
+        points[a] -= a;
+    }
+}
+
+/* Value of keeping each smaller multiset: the average over the next die. */
+void averageRolls(unsigned *ev)
+{
+    register const unsigned char *next;
+    register unsigned *to;
+    static const unsigned *from;
+    static unsigned char n, k;
+    static unsigned sum;
+
+    for (n = MAXDICE - 1; ; n--) {
+        to = ev + setBase[n];
+        from = ev + setBase[n + 1];
+        next = diceNext + setBase[n] * 6;
+        for (k = setBase[n + 1] - setBase[n]; k; k--) {
+            sum = from[next[0]];
+            sum += from[next[1]];
+            sum += from[next[2]];
+            sum += from[next[3]];
+            sum += from[next[4]];
+            sum += from[next[5]];
+            *to++ = sum / 6;
+            next += 6;
+        }
+        if (n == 0) {
+            break;
+        }
+    }
+}
+
+/*
+ * Value of each five dice with a roll still to come: the best value
+ * of the multisets it contains.
+ */
+void keepBest(unsigned *ev)
+{
+    register const unsigned char *next;
+    register unsigned *to;
+    static const unsigned *from;
+    static unsigned char n, k, f, j;
+    static unsigned v, w;
+
+    next = diceNext;
+    from = ev;
+    for (n = 0; n < MAXDICE; n++) {
+        to = ev + setBase[n + 1];
+        for (k = setBase[n + 1] - setBase[n]; k; k--) {
+            v = *from++;
+            for (f = 0; f < 6; f++) {
+                j = *next++;
+                w = to[j];
+                if (v > w) {
+                    to[j] = v;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Computer decides what dice to roll again (by setting them to
+ * UNSET). Returns false if does not want to roll any.
+ */
+bool askComputerDiceToRollAgain()
+{
+    static unsigned char keep, best, p, n;
+    static unsigned k, v, keepValue;
+    static unsigned *ev;
+
+    if (roll == 1) {
+        planCategories();
+        scoreRolls();
+        averageRolls(oneRoll);
+        memcpy(twoRolls, oneRoll, sizeof(twoRolls));
+        keepBest(twoRolls);
+        averageRolls(twoRolls);
+        ev = twoRolls;
+    } else {
+        ev = oneRoll;
+    }
+
+    /* Try each set of dice to keep, all of them first. */
+    for (keep = 31; ; keep--) {
+        k = 0;
+        n = 0;
+        for (p = 0; p < MAXDICE; p++) {
+            if (keep & (1 << p)) {
+                k = setBase[n + 1] + diceNext[k * 6 + dice[p] - 1];
+                n++;
+            }
+        }
+        v = ev[k];
+        if (keep == 31 || v > keepValue) {
+            keepValue = v;
+            best = keep;
+        }
+        if (keep == 0) {
+            break;
+        }
+    }
+
+    for (p = 0; p < MAXDICE; p++) {
+        if (!(best & (1 << p))) {
+            dice[p] = UNSET;
+        }
+    }
+    return best != 31;
+}
+
+/* Computer decides what category to play. */
+int computerPickCategory()
+{
+    int i;
+
+    planCategories();
+    memset(count, 0, sizeof(count));
+    memset(points, 0, sizeof(points));
+    total = 0;
+    for (i = 0; i < MAXDICE; i++) {
+        ++count[dice[i]];
+        points[dice[i]] += dice[i];
+        total += dice[i];
+    }
+    bestScore();
+    return bestCategory;
+}
+
+#ifdef __APPLE2__
+#pragma code-name (pop)
+#pragma rodata-name (pop)
+#endif
+
+#else
+
 /*
  * Computer decides what dice to roll again (by setting them to
  * UNSET). Returns false if does not want to roll any.
@@ -1071,6 +1606,8 @@ int computerPickCategory()
     return 0;
 }
 
+#endif
+
 /* Set random seed for the rand() function. */
 void setRandomSeed()
 {
@@ -64,6 +64,7 @@ byte MRLOCK;		// magic register lock out
 byte GAMSTB;		// game status
 byte PRIOR;		// music protect
 byte SENFLG; 		// sentry control
+byte GCLINE;		// glyph cache first scanline (0 = off)
 
 byte* UMARGT;		// user mask table (-64 bytes)
 word* USERTB;		// user routine table (-128 bytes)
@@ -178,10 +179,6 @@ void MRET(ContextBlock *ctx) {
   ctx; // TODO
 }
 
-void NOOP(ContextBlock *ctx) {
-  ctx;
-}
-
 // jump within MCALL
 void MJUMP(ContextBlock *ctx) {
   ctx->params = (byte*) _HL; // TODO?
@@ -303,18 +300,6 @@ void RANGED(ContextBlock *ctx) {
   }
 }
 
-void INDEXB(ContextBlock *ctx) {
-  word addr = _HL + _A;
-  _HL = addr;
-  _A = *((byte*)addr);
-}
-
-void INDEXW(ContextBlock *ctx) {
-  word addr = _HL + _A*2;
-  _HL = addr;
-  _DE = *((word*)addr);
-}
-
 void INDEXN(ContextBlock *ctx) {
   byte ofs = _C;
   word addr = _HL + ofs/2;
@@ -322,14 +307,6 @@ void INDEXN(ContextBlock *ctx) {
   _A = (ofs & 1) ? (val>>4) : (val&0xf);
 }
 
-// input
-
-extern const byte KCTASC_TABLE[25];
-
-void KCTASC(ContextBlock *ctx) {
-  _A = KCTASC_TABLE[_B];
-}
-
 // music
 
 void BMUSIC(ContextBlock *ctx) {
@@ -358,6 +335,14 @@ extern void CHRDIS(const ContextBlock *ctx);
 extern void STRDIS(const ContextBlock *ctx);
 extern void DISNUM(const ContextBlock *ctx);
 
+// SYS_FAST routines in biosasm.s (take registers, not ctx)
+extern void NOOP(ContextBlock *ctx);
+extern void INDEXB(ContextBlock *ctx);
+extern void INDEXW(ContextBlock *ctx);
+extern void KCTASC(ContextBlock *ctx);
+
+extern void call_fast(ContextBlock *ctx, SysRoutine* routine);
+
 // table
 
 const SysCallEntry SYSCALL_TABLE[64] = {
@@ -380,73 +365,75 @@ const SysCallEntry SYSCALL_TABLE[64] = {
   { &FILL,	REG_A|REG_BC|REG_DE },
   { &RECTAN,	REG_A|REG_B|REG_C|REG_D|REG_E },
   /* 30 */
-  { &NOOP,	REG_HL|REG_IX },	// VWRITR
+  { &NOOP,	SYS_FAST|REG_HL|REG_IX },	// VWRITR
   { &WRITR,  	REG_E|REG_D|REG_A|REG_HL },
   { &WRITP,  	REG_E|REG_D|REG_A|REG_HL },
   { &WRIT,   	REG_E|REG_D|REG_C|REG_B|REG_A|REG_HL },
-  { &NOOP,	REG_E|REG_D|REG_C|REG_B|REG_A|REG_HL },	// WRITA
+  { &NOOP,	SYS_FAST|REG_E|REG_D|REG_C|REG_B|REG_A|REG_HL },	// WRITA
   /* 40 */
-  { &NOOP,	REG_E|REG_D|REG_IX },	// VBLANK
-  { &NOOP,	REG_E|REG_D|REG_B|REG_HL },	// BLANK
-  { &NOOP,	REG_B|REG_C|REG_DE|REG_HL },	// SAVE
-  { &NOOP,	REG_DE|REG_HL },	// RESTORE
-  { &NOOP,	REG_B|REG_C|REG_DE|REG_HL },	// SCROLL
+  { &NOOP,	SYS_FAST|REG_E|REG_D|REG_IX },	// VBLANK
+  { &NOOP,	SYS_FAST|REG_E|REG_D|REG_B|REG_HL },	// BLANK
+  { &NOOP,	SYS_FAST|REG_B|REG_C|REG_DE|REG_HL },	// SAVE
+  { &NOOP,	SYS_FAST|REG_DE|REG_HL },	// RESTORE
+  { &NOOP,	SYS_FAST|REG_B|REG_C|REG_DE|REG_HL },	// SCROLL
   /* 50 */
   { &CHRDIS,	REG_E|REG_D|REG_C|REG_A },
   { &STRDIS,	REG_E|REG_D|REG_C|REG_HL },
   { &DISNUM,	REG_E|REG_D|REG_C|REG_B|REG_HL },
-  { &NOOP,	REG_DE|REG_A },	// RELABS
-  { &NOOP,	REG_E|REG_D|REG_A },	// RELAB1
+  { &NOOP,	SYS_FAST|REG_DE|REG_A },	// RELABS
+  { &NOOP,	SYS_FAST|REG_E|REG_D|REG_A },	// RELAB1
   /* 60 */
-  { &NOOP,	REG_IX|REG_HL|REG_C },	// VECTC
-  { &NOOP,	REG_IX|REG_HL },	// VECT
-  { &KCTASC,	0 },
+  { &NOOP,	SYS_FAST|REG_IX|REG_HL|REG_C },	// VECTC
+  { &NOOP,	SYS_FAST|REG_IX|REG_HL },	// VECT
+  { &KCTASC,	SYS_FAST },
   { &SENTRY, 	REG_DE },
   { &DOIT,	REG_HL },
   /* 70 */
   { &DOITB,	REG_HL },
-  { &NOOP,	0 },	// PIZBRK
-  { &NOOP,	REG_DE|REG_HL },	// MENU
-  { &NOOP,	REG_BC|REG_HL },	// GETPAR
-  { &NOOP,	REG_B|REG_C|REG_D|REG_E|REG_HL },	// GETNUM
+  { &NOOP,	SYS_FAST },	// PIZBRK
+  { &NOOP,	SYS_FAST|REG_DE|REG_HL },	// MENU
+  { &NOOP,	SYS_FAST|REG_BC|REG_HL },	// GETPAR
+  { &NOOP,	SYS_FAST|REG_B|REG_C|REG_D|REG_E|REG_HL },	// GETNUM
   /* 80 */
   { &PAWS,	REG_B },
-  { &NOOP,	REG_E|REG_D|REG_C },	// DISTIM
-  { &NOOP,	REG_HL },	// INCSCR
+  { &NOOP,	SYS_FAST|REG_E|REG_D|REG_C },	// DISTIM
+  { &NOOP,	SYS_FAST|REG_HL },	// INCSCR
   { &INDEXN,	REG_C|REG_HL },	// INDEXN
-  { &NOOP,	REG_HL },	// STOREN
+  { &NOOP,	SYS_FAST|REG_HL },	// STOREN
   /* 90 */
-  { &INDEXW,	REG_A|REG_HL },	// INDEXW
-  { &INDEXB,	REG_A|REG_HL },	// INDEXB
+  { &INDEXW,	SYS_FAST|REG_A|REG_HL },	// INDEXW
+  { &INDEXB,	SYS_FAST|REG_A|REG_HL },	// INDEXB
   { &MOVE,	REG_DE|REG_BC|REG_HL },
-  { &NOOP,	0 },	// SHIFTU
+  { &NOOP,	SYS_FAST },	// SHIFTU
   { &BCDADD,	REG_DE|REG_B|REG_HL },
   /* 100 */
-  { &NOOP,	0 },	// BCDSUB
-  { &NOOP,	0 },	// BCDMUL
-  { &NOOP,	0 },	// BCDDIV
-  { &NOOP,	0 },	// BCDCHS
-  { &NOOP,	0 },	// BCDNEG
+  { &NOOP,	SYS_FAST },	// BCDSUB
+  { &NOOP,	SYS_FAST },	// BCDMUL
+  { &NOOP,	SYS_FAST },	// BCDDIV
+  { &NOOP,	SYS_FAST },	// BCDCHS
+  { &NOOP,	SYS_FAST },	// BCDNEG
   /* 110 */
-  { &NOOP,	0 },	// DADD
-  { &NOOP,	0 },	// DSMG
-  { &NOOP,	0 },	// DABS
-  { &NOOP,	0 },	// NEGT
+  { &NOOP,	SYS_FAST },	// DADD
+  { &NOOP,	SYS_FAST },	// DSMG
+  { &NOOP,	SYS_FAST },	// DABS
+  { &NOOP,	SYS_FAST },	// NEGT
   { &RANGED,	REG_A },
   /* 120 */
-  { &NOOP,	0 },	// QUIT
-  { &NOOP,	REG_A|REG_HL },	// SETB
-  { &NOOP,	REG_DE|REG_HL },	// SETW
-  { &NOOP,	REG_C|REG_DE|REG_HL },	// MSKTD
+  { &NOOP,	SYS_FAST },	// QUIT
+  { &NOOP,	SYS_FAST|REG_A|REG_HL },	// SETB
+  { &NOOP,	SYS_FAST|REG_DE|REG_HL },	// SETW
+  { &NOOP,	SYS_FAST|REG_C|REG_DE|REG_HL },	// MSKTD
 };
 
-void SYSCALL(ContextBlock *ctx) {
+// decode a call and run it, except SYS_FAST routines are returned
+// so the caller can run them with registers loaded from ctx
+SysRoutine* syscall_dispatch(ContextBlock *ctx) {
   byte op = *ctx->params++;
   byte argmask;
   SysRoutine* routine;
   // user-defined?
   if (op & 0x80) {
-    argmask = UMARGT[op>>1];
+    argmask = UMARGT[op>>1] & ~SYS_FAST;
     routine = (SysRoutine*) USERTB[op>>1];
   } else {
     const SysCallEntry* entry = &SYSCALL_TABLE[op>>1];
@@ -457,8 +444,19 @@ void SYSCALL(ContextBlock *ctx) {
   if (op & 1) {
     suckParams(ctx, argmask);
   }
+  if (argmask & SYS_FAST) {
+    return routine;
+  }
   // call the routine
   routine(ctx);
+  return 0;
+}
+
+void SYSCALL(ContextBlock *ctx) {
+  SysRoutine* fast = syscall_dispatch(ctx);
+  if (fast) {
+    call_fast(ctx, fast);
+  }
 }
 
 void bios_init() {
@@ -128,6 +128,9 @@ typedef struct {
 #define REG_DE	(REG_D|REG_E)
 #define REG_BC	(REG_B|REG_C)
 
+// argmask flag: routine takes and returns registers (see SYSCALL38)
+#define SYS_FAST REG_IY
+
 #define _IY	(ctx->regs.w.iy)
 #define _IX	(ctx->regs.w.ix)
 #define _DE	(ctx->regs.w.de)
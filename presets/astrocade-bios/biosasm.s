@@ -33,18 +33,56 @@ FoundSentinel:
 	jp	(HL)		; jump to cart start vector
 
 .ds	0x38 - (. - BIOSStart)	; eat up space until 0x38
-.globl	SYSCALL38
+.globl	SYSCALL38,_SYSCALL_TABLE
 SYSCALL38:
-	push	hl
+	push	hl		; push in context block order
 	push	af
 	push	bc
 	push	de
+; fast path: SYS_FAST routine without inline params gets registers as-is
+	ld	hl,#9
+	add	hl,sp
+	ld	d,(hl)
+	dec	hl
+	ld	e,(hl)		; DE = return address -> opcode
+	ld	a,(de)
+	rra			; A = index, carry = suck params
+	jr	c,SysContext
+	cp	#64
+	jr	nc,SysContext	; user routine
+	ld	c,a
+	add	a,a
+	add	a,c
+	ld	c,a
+	ld	b,#0
+	ld	hl,#_SYSCALL_TABLE+2
+	add	hl,bc		; HL = &SYSCALL_TABLE[index].argmask
+	bit	0,(hl)		; SYS_FAST?
+	jr	z,SysContext
+	dec	hl
+	ld	b,(hl)
+	dec	hl
+	ld	c,(hl)		; BC = routine
+	ld	hl,#8
+	add	hl,sp
+	inc	de		; skip opcode
+	ld	(hl),e
+	inc	hl
+	ld	(hl),d		; new return address
+	ld	h,b
+	ld	l,c
+	jr	SysRunFast
+; slow path: registers in context block
+SysContext:
 	push	ix
 	push	iy
 	ld	hl,#0
 	add	hl,sp
 	push	hl		; HL points to context block
-	call	_SYSCALL	; syscall handler
+	call	_syscall_dispatch	; syscall handler
+	ld	a,h
+	or	l
+	jr	nz,SysRunCtx	; HL = SYS_FAST routine?
 	pop	hl
 	pop	iy
 	pop	ix
@@ -53,6 +91,16 @@ SYSCALL38:
 	pop	af
 	pop	hl
 	ret
+SysRunCtx:
+	pop	iy		; discard context block pointer
+	pop	iy
+	pop	ix
+SysRunFast:
+	pop	de
+	pop	bc
+	pop	af
+	ex	(sp),hl		; restore HL, routine -> stack
+	ret			; jump to routine
 
 ; out to port
 .globl	_portOut
@@ -84,6 +132,140 @@ _set_palette:
   otir		; write C bytes from HL to port[B]
   ret
 
+;void draw_cached(const FontDescriptor* font, const byte* src, byte ch,
+;                 byte* dest, byte magic, byte op);
+; 1x1 glyph cache (see gfx.c), 16 slots of 32 bytes at line GCLINE:
+; font (2), ch, key = op<<4|shift, 8 rows x 3 expanded bytes, pad
+.globl	_draw_cached,_GCLINE
+_draw_cached:
+	push	ix
+	ld	ix,#0
+	add	ix,sp
+	ld	l,4(ix)
+	ld	h,5(ix)
+	ld	de,#4
+	add	hl,de
+	ld	b,(hl)		; B = font->pattern_y
+	ld	a,12(ix)
+	rlca
+	rlca
+	rlca
+	rlca
+	and	#0xf0
+	ld	c,a
+	ld	a,11(ix)
+	and	#3
+	or	c
+	ld	c,a		; C = key
+	ld	a,(_GCLINE)
+	ld	l,a
+	ld	h,#0
+	add	hl,hl
+	add	hl,hl
+	add	hl,hl
+	ld	e,l
+	ld	d,h
+	add	hl,hl
+	add	hl,hl
+	add	hl,de		; HL = GCLINE * 40
+	ld	a,8(ix)
+	add	c
+	and	#15
+	rrca
+	rrca
+	rrca
+	ld	d,a
+	and	#0xe0
+	ld	e,a
+	ld	a,d
+	and	#1
+	or	#0x40		; + vidmem
+	ld	d,a		; DE = 0x4000 + ((ch+key)&15)*32
+	add	hl,de		; HL = slot
+	push	hl
+	ld	a,(hl)
+	cp	4(ix)
+	jr	nz,GCMiss
+	inc	hl
+	ld	a,(hl)
+	cp	5(ix)
+	jr	nz,GCMiss
+	inc	hl
+	ld	a,(hl)
+	cp	8(ix)
+	jr	nz,GCMiss
+	inc	hl
+	ld	a,(hl)
+	cp	c
+	jr	z,GCHit
+GCMiss:				; evict and expand into slot
+	pop	hl
+	push	hl
+	ld	a,4(ix)
+	ld	(hl),a
+	inc	hl
+	ld	a,5(ix)
+	ld	(hl),a
+	inc	hl
+	ld	a,8(ix)
+	ld	(hl),a
+	inc	hl
+	ld	(hl),c
+	inc	hl
+	res	6,h		; slot data via magic (-0x4000)
+	ld	a,12(ix)
+	and	#0x0f
+	out	(0x19),a	; XPAND colors
+	ld	a,11(ix)
+	and	#0xcf
+	ld	c,a		; C = magic, no OR/XOR
+	ld	e,6(ix)
+	ld	d,7(ix)		; DE = src
+	push	bc
+GCExpand:
+	ld	a,c
+	out	(0x0c),a	; MAGIC (reset flip flop)
+	ld	a,(de)
+	inc	de
+	ld	(hl),a
+	inc	hl
+	ld	(hl),a
+	inc	hl
+	ld	(hl),#0
+	inc	hl
+	djnz	GCExpand
+	pop	bc
+GCHit:				; copy rows to screen
+	pop	hl
+	ld	de,#4
+	add	hl,de		; HL = slot data
+	ld	a,11(ix)
+	and	#0x30
+	out	(0x0c),a	; MAGIC, OR/XOR only
+	ld	e,9(ix)
+	ld	d,10(ix)	; DE = dest
+GCCopy:
+	ld	a,(hl)
+	ld	(de),a
+	inc	hl
+	inc	de
+	ld	a,(hl)
+	ld	(de),a
+	inc	hl
+	inc	de
+	ld	a,(hl)
+	ld	(de),a
+	inc	hl
+	ld	a,e
+	add	#40-2
+	ld	e,a
+	jr	nc,GCNext
+	inc	d
+GCNext:
+	djnz	GCCopy
+	pop	ix
+	ret
+
 .globl _KCTASC_TABLE
 _KCTASC_TABLE:
 .db  0x00
@@ -105,3 +287,124 @@ DOPEVector:
 	.db	0x3f
 	.db	0x3f
 
+;void call_fast(ContextBlock *ctx, SysRoutine* routine);
+; run a SYS_FAST routine with registers from ctx, then store them back
+.globl	_call_fast
+_call_fast:
+	pop	bc		; return address
+	pop	hl		; HL = ctx
+	pop	de		; DE = routine
+	push	de
+	push	hl
+	push	bc
+	push	ix
+	push	iy
+	push	hl		; ctx, for CallFastRet
+	ld	bc,#CallFastRet
+	push	bc
+	push	de
+	inc	hl
+	inc	hl		; skip IY
+	ld	e,(hl)
+	inc	hl
+	ld	d,(hl)
+	inc	hl
+	push	de
+	pop	ix
+	ld	e,(hl)
+	inc	hl
+	ld	d,(hl)
+	inc	hl
+	ld	c,(hl)
+	inc	hl
+	ld	b,(hl)
+	inc	hl
+	push	bc
+	ld	c,(hl)
+	inc	hl
+	ld	b,(hl)
+	inc	hl
+	push	bc
+	pop	af
+	pop	bc
+	push	af
+	ld	a,(hl)
+	inc	hl
+	ld	h,(hl)
+	ld	l,a
+	pop	af
+	ret			; jump to routine
+CallFastRet:
+	ex	(sp),hl		; HL = ctx
+	push	af
+	push	bc
+	push	ix
+	pop	bc
+	inc	hl
+	inc	hl
+	ld	(hl),c		; IX
+	inc	hl
+	ld	(hl),b
+	inc	hl
+	ld	(hl),e		; DE
+	inc	hl
+	ld	(hl),d
+	inc	hl
+	pop	bc
+	ld	(hl),c		; BC
+	inc	hl
+	ld	(hl),b
+	inc	hl
+	pop	bc
+	ld	(hl),c		; AF
+	inc	hl
+	ld	(hl),b
+	inc	hl
+	pop	bc
+	ld	(hl),c		; HL
+	inc	hl
+	ld	(hl),b
+	pop	iy
+	pop	ix
+	ret
+
+; SYS_FAST routines: args and results in registers, may change flags
+.globl	_NOOP,_INDEXB,_INDEXW,_KCTASC
+_NOOP:
+	ret
+
+; HL += A, A = (HL)
+_INDEXB:
+	add	a,l
+	ld	l,a
+	jr	nc,1$
+	inc	h
+1$:	ld	a,(hl)
+	ret
+
+; HL += A*2, DE = (HL)
+_INDEXW:
+	push	bc
+	ld	c,a
+	ld	b,#0
+	add	hl,bc
+	add	hl,bc
+	ld	e,(hl)
+	inc	hl
+	ld	d,(hl)
+	dec	hl
+	pop	bc
+	ret
+
+; A = ASCII for key code B
+_KCTASC:
+	push	hl
+	push	bc
+	ld	c,b
+	ld	b,#0
+	ld	hl,#_KCTASC_TABLE
+	add	hl,bc
+	ld	a,(hl)
+	pop	bc
+	pop	hl
+	ret
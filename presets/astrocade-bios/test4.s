@@ -0,0 +1,223 @@
+; BIOS call microbenchmark
+; Times N calls of each common BIOS call with the frame counter (CT0)
+; and shows elapsed frames. Link this instead of test1.s in bios.c.
+
+; need these in 1st file sdcc linker sees
+.area _HOME
+.area _INITIALIZER
+.area _DATA
+.area _INITIALIZED
+.area _BSEG
+.area _BSS
+.area _HEAP
+.area _CODE
+
+	.include "astrocade.inc"
+        .globl	_main
+
+BenchBCD = 0x4f00	; 3-digit result (RAM)
+Scratch	 = 0x4f08	; BCDADD destination
+
+; BENCH routine, count, y
+	.macro	BENCH rtn, count, ypos
+        ld	hl,#rtn
+        ld	de,#count
+        ld	b,#ypos
+        call	RunBench
+        .endm
+
+_main:
+	LD	SP,#0x4fce	; position stack below BIOS vars
+        SYSTEM	INTPC
+        DO	SETOUT
+        .db	102*2, 23, 0x08
+        DONT	EMUSIC
+        DONT	ACTINT
+        DO	COLSET
+        .dw	palette
+        DO	FILL
+        .dw	0x4000
+        .dw	96*40
+        .db	0x00
+        EXIT
+        nop
+        BENCH	BNoop, 1024, 12
+        BENCH	BIndexB, 1024, 19
+        BENCH	BKctasc, 1024, 26
+        BENCH	BRanged, 256, 33
+        BENCH	BSetout, 256, 40
+        BENCH	BColset, 256, 47
+        BENCH	BBcdadd, 256, 54
+        BENCH	BSentry, 256, 61
+        BENCH	BFill, 64, 68
+        BENCH	BRectan, 64, 75
+        BENCH	BStrdis, 16, 82
+        BENCH	BDisnum, 16, 89
+.loop:
+	jr	.loop
+
+; HL = routine, DE = count, B = y
+; prints label (at HL-16) and frames elapsed
+RunBench:
+	push	bc
+        push	hl
+        ld	a,(CT0)
+        ld	c,a
+.sync:
+	ld	a,(CT0)		; wait for next frame
+        cp	c
+        jr	z,.sync
+        push	af
+.rep:
+	push	hl
+        push	de
+        call	.callhl
+        pop	de
+        pop	hl
+        dec	de
+        ld	a,d
+        or	e
+        jr	nz,.rep
+        pop	bc		; B = start frame
+        ld	a,(CT0)
+        sub	b		; A = frames elapsed
+        call	ToBCD
+        pop	hl
+        pop	bc
+        ld	de,#-16
+        add	hl,de		; label
+        ld	d,b
+        ld	e,#0
+        ld	c,#0x0c
+        SYSTEM	STRDIS
+        ld	hl,#BenchBCD
+        ld	e,#136
+        ld	b,#3|0x80
+        SYSTEM	DISNUM
+        ret
+.callhl:
+	jp	(hl)
+
+; A -> 3 BCD digits at BenchBCD
+ToBCD:
+	ld	c,#0
+.hund:
+	cp	#100
+        jr	c,.tens
+        sub	#100
+        inc	c
+        jr	.hund
+.tens:
+	ld	b,#0
+.tens1:
+	cp	#10
+        jr	c,.ones
+        sub	#10
+        inc	b
+        jr	.tens1
+.ones:
+	ld	e,a
+        ld	a,b
+        rlca
+        rlca
+        rlca
+        rlca
+        or	e
+        ld	(BenchBCD),a
+        ld	a,c
+        ld	(BenchBCD+1),a
+        ret
+
+; each routine is preceded by its 16-byte label
+	.ascii	"NOOP     X1024"
+        .db	0,0
+BNoop:
+	SYSTEM	PIZBRK
+        ret
+	.ascii	"INDEXB   X1024"
+        .db	0,0
+BIndexB:
+	ld	hl,#palette
+        ld	a,#3
+        SYSTEM	INDEXB
+        ret
+	.ascii	"KCTASC   X1024"
+        .db	0,0
+BKctasc:
+	ld	b,#5
+        SYSTEM	KCTASC
+        ret
+	.ascii	"RANGED   X256"
+        .db	0,0,0
+BRanged:
+	ld	a,#100
+        SYSTEM	RANGED
+        ret
+	.ascii	"SETOUT   X256"
+        .db	0,0,0
+BSetout:
+	SYSSUK	SETOUT
+        .db	102*2, 23, 0x08
+        ret
+	.ascii	"COLSET   X256"
+        .db	0,0,0
+BColset:
+	SYSSUK	COLSET
+        .dw	palette
+        ret
+	.ascii	"BCDADD   X256"
+        .db	0,0,0
+BBcdadd:
+	SYSSUK	BCDADD
+        .dw	Scratch
+        .db	3
+        .dw	BCDINC
+        ret
+	.ascii	"SENTRY   X256"
+        .db	0,0,0
+BSentry:
+	SYSSUK	SENTRY
+        .dw	keymask
+        ret
+	.ascii	"FILL 40  X64"
+        .db	0,0,0,0
+BFill:
+	SYSSUK	FILL
+        .dw	0x4000+9*40
+        .dw	40
+        .db	0x00
+        ret
+	.ascii	"RECTAN   X64"
+        .db	0,0,0,0
+BRectan:
+	SYSSUK	RECTAN
+        .db	120, 0, 8, 8, 0x55
+        ret
+	.ascii	"STRDIS   X16"
+        .db	0,0,0,0
+BStrdis:
+	SYSSUK	STRDIS
+        .db	0, 0, 0x0c
+        .dw	Score
+        ret
+	.ascii	"DISNUM   X16"
+        .db	0,0,0,0
+BDisnum:
+	SYSSUK	DISNUM
+        .db	60, 0, 0x0c, 6
+        .dw	BCDINC
+        ret
+
+Score:
+	.ascii	"SCORE"
+        .db	0
+palette:
+	.db	0x77, 0xD4, 0x35, 0x01
+	.db	0x07, 0xD4, 0x35, 0x01
+keymask:
+	.db	0b111111
+	.db	0b111111
+	.db	0b111111
+	.db	0b111111
+BCDINC:
+        .db	0x01,0x00,0x00
@@ -5,4 +5,20 @@ extern void fast_sprite_8(const byte* pattern, byte* dst);
 extern void fast_sprite_16(const byte* pattern, byte* dst);
 // clips off bottom
 extern void fast_sprite_16_yclip(const byte* pattern, byte* dst, byte height);
+// fills 1-255 bytes of regular RAM
+extern void fast_fill(byte* dst, byte count, byte value);
+// fills a 1-40 by 1-255 byte rectangle of regular RAM
+extern void fast_rect(byte* dst, byte width, byte height, byte value);
+
+// pre-shifted sprite, made by tools/astrocade/acsprite.py
+// draw[x&3] writes the sprite to screen RAM at dst
+typedef void (*prebaked_fn)(byte* dst) __z88dk_fastcall;
+typedef struct {
+  byte width;		// bytes written per line
+  byte height;
+  prebaked_fn draw[4];
+} PrebakedSprite;
+
+#define draw_prebaked(spr, x, y) \
+  (spr)->draw[(x)&3](&vidmem[y][(x)>>2])
 
@@ -82,3 +82,59 @@ _fast_sprite_16_yclip:
   ld	c,8(ix)		; height (C)
   inc	hl		; skip width
   jp	fast_sprite_16_clip_entry
+
+;void fast_fill(byte* dst, byte count, byte value) {
+; fills 1-255 bytes of regular RAM (not magic)
+.globl	_fast_fill
+_fast_fill:
+  pop	bc		; return address
+  pop	hl		; dst (HL)
+  pop	de		; count (E), value (D)
+  push	de
+  push	hl
+  push	bc
+  ld	(hl),d		; store 1st byte
+  dec	e
+  ret	z		; exit if count == 1
+  ld	c,e
+  ld	b,#0		; BC = count - 1
+  ld	d,h
+  ld	e,l
+  inc	de		; DE = dst + 1
+  ldir			; copy each byte to the next
+  ret
+
+;void fast_rect(byte* dst, byte width, byte height, byte value) {
+; fills a 1-40 by 1-255 byte rectangle of regular RAM (not magic)
+.globl	_fast_rect
+_fast_rect:
+  push	ix
+  ld	ix,#0
+  add	ix,sp		; IX = arg pointer
+  ld	l,4(ix)		; dst (HL)
+  ld	h,5(ix)
+  ld	b,7(ix)		; height (B)
+  ld	c,8(ix)		; value (C)
+  ld	a,6(ix)		; width
+  add	a,a
+  neg
+  ld	e,a
+  ld	d,#0xff		; DE = -width*2
+  ld	a,#40
+  sub	6(ix)
+  ld	ix,#002$
+  add	ix,de		; IX = entry into unrolled loop
+  ld	e,a
+  ld	d,#0		; DE = 40 - width (next scanline)
+  ld	a,c		; value -> A
+001$:
+  jp	(ix)		; store width bytes
+  .rept	40
+  ld	(hl),a
+  inc	hl
+  .endm
+002$:
+  add	hl,de		; next scanline
+  djnz	001$
+  pop	ix
+  ret
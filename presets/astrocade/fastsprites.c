@@ -7,6 +7,7 @@
 #include "acfast.h"
 //#link "acfast.s"
 //#link "hdr_autostart.s"
+//#link "fastsprites_pre.s"
 
 #include <stdlib.h>
 #include <string.h>
@@ -26,6 +27,14 @@ const byte SPRITE[] = {
   0x45,0xD1, 0x05,0x50, 0x04,0x10, 0x3C,0x3C,
 };
 
+// pre-shifted copy of SPRITE, made with:
+// tools/astrocade/acsprite.py fastsprites.c SPRITE > fastsprites_pre.s
+extern const PrebakedSprite SPRITE_prebaked;
+
+// draw with pre-shifted sprites and erase by rectangle,
+// instead of XORing through the magic register twice
+#define PREBAKED
+
 #define MAX_SPRITES 8
 
 typedef struct {
@@ -33,12 +42,31 @@ typedef struct {
   byte y;		// y coordinate
   byte lastmagic;	// last magic byte used
   byte* lastdest;	// last destination address
+#ifdef PREBAKED
+  const PrebakedSprite* pattern;
+#else
   const byte* pattern;	// pattern definition
+#endif
   byte _unused;
 } Actor;
 
 Actor actors[MAX_SPRITES];
 
+#ifdef PREBAKED
+
+void erase_actor(Actor* actor) {
+  fast_rect(actor->lastdest, actor->pattern->width, actor->pattern->height, 0);
+}
+
+void draw_actor(Actor* actor) {
+  byte x = actor->x;
+  byte y = actor->y;
+  actor->lastdest = &vidmem[y][x>>2];	// destination address
+  actor->pattern->draw[x&3](actor->lastdest);
+}
+
+#else
+
 void erase_actor(Actor* actor) {
   hw_magic = actor->lastmagic;
   fast_sprite_8(actor->pattern, actor->lastdest);
@@ -53,6 +81,8 @@ void draw_actor(Actor* actor) {
   erase_actor(actor);
 }
 
+#endif
+
 void main(void) {
   byte i;
   // setup palette
@@ -69,15 +99,23 @@ void main(void) {
   for (i=0; i<MAX_SPRITES; i++) {
     actors[i].x = rand() & 0x7f;
     actors[i].y = (i*8) & 0x3f;
+#ifdef PREBAKED
+    actors[i].pattern = &SPRITE_prebaked;
+#else
     actors[i].pattern = SPRITE;
+#endif
     draw_actor(&actors[i]);
   }
   while (1) {
     fast_vsync();
     hw_col0r = 0x2;
+    // erase them all before drawing any, since erasing a rectangle
+    // also takes out the pixels of any sprite overlapping it
+    for (i=0; i<MAX_SPRITES; i++) {
+      erase_actor(&actors[i]);
+    }
     for (i=0; i<MAX_SPRITES; i++) {
       Actor* a = &actors[i];
-      erase_actor(a);
       draw_actor(a);
       a->x++;
     }
@@ -0,0 +1,339 @@
+; generated by tools/astrocade/acsprite.py -- do not edit
+.area	_CODE
+
+; SPRITE: 2 x 8 bytes
+; magic register: ~760 cycles
+; _SPRITE_s0: ~593 cycles
+; _SPRITE_s1: ~625 cycles
+; _SPRITE_s2: ~539 cycles
+; _SPRITE_s3: ~635 cycles
+.globl	_SPRITE_prebaked
+_SPRITE_prebaked:
+  .db	3,8
+  .dw	_SPRITE_s0,_SPRITE_s1,_SPRITE_s2,_SPRITE_s3
+_SPRITE_s0:
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ld	bc,#39
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x06
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x90
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x15
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x54
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0x30
+  or	#0x47
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x0c
+  or	#0x51
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0x30
+  or	#0x45
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x0c
+  or	#0xd1
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf3
+  or	#0x04
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0xcf
+  or	#0x10
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xc3
+  or	#0x3c
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0xc3
+  or	#0x3c
+  ld	(hl),a
+  ret
+_SPRITE_s1:
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  ld	bc,#39
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0xa4
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x55
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xcc
+  or	#0x11
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0xd4
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ld	de,#38
+  add	hl,de
+  ld	a,(hl)
+  and	#0xcc
+  or	#0x11
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x74
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x54
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0xf3
+  or	#0x04
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x0f
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x0f
+  ld	(hl),a
+  ret
+_SPRITE_s2:
+  inc	hl
+  ld	a,(hl)
+  and	#0xc3
+  or	#0x14
+  ld	(hl),a
+  ld	bc,#40
+  add	hl,bc
+  ld	(hl),#0x69
+  ld	de,#39
+  add	hl,de
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x55
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ld	bc,#38
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf3
+  or	#0x04
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x75
+  inc	hl
+  ld	a,(hl)
+  and	#0xcf
+  or	#0x10
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf3
+  or	#0x04
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x5d
+  inc	hl
+  ld	a,(hl)
+  and	#0xcf
+  or	#0x10
+  ld	(hl),a
+  add	hl,de
+  ld	(hl),#0x55
+  ld	bc,#40
+  add	hl,bc
+  ld	a,(hl)
+  and	#0x3c
+  or	#0x41
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x03
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3c
+  or	#0xc3
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0xc0
+  ld	(hl),a
+  ret
+_SPRITE_s3:
+  inc	hl
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  ld	bc,#40
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x1a
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ld	de,#39
+  add	hl,de
+  ld	(hl),#0x55
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  ld	bc,#38
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x1d
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x33
+  or	#0x44
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x17
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x33
+  or	#0x44
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x15
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xcf
+  or	#0x10
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0x0f
+  or	#0xf0
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0xf0
+  ld	(hl),a
+  ret
@@ -7,6 +7,7 @@
 #include "acfast.h"
 //#link "acfast.s"
 //#link "hdr_autostart.s"
+//#link "racing_pre.s"
 
 #include <stdlib.h>
 #include <string.h>
@@ -71,6 +72,7 @@ const byte CURBS[4*16] = {
   0xAA, 0xAA,  0xAA, 0xAA,
 };
 
+// opaque pixels of CAR_10, for tools/astrocade/acsprite.py
 const byte CAR_10_MASK[2+4*10] = {
   4,10,
 /*{w:16,h:10,bpp:2,brev:1}*/
@@ -86,21 +88,6 @@ const byte CAR_10_MASK[2+4*10] = {
   0x3F, 0xC0, 0x03, 0xFC,
 };
 
-const byte CAR_10_INV[2+4*10] = {
-  4,10,
-/*{w:16,h:10,bpp:2,brev:1}*/
-  0x02, 0x80, 0x02, 0x80,
-  0x02, 0x95, 0x56, 0x80,
-  0x00, 0x16, 0x94, 0x00,
-  0x00, 0x58, 0x25, 0x00,
-  0x2A, 0x51, 0x45, 0xA8,
-  0x82, 0x6A, 0xA9, 0x82,
-  0xAA, 0x96, 0x96, 0xAA,
-  0xAA, 0x56, 0x95, 0xAA,
-  0xAA, 0x7F, 0xFD, 0xAA,
-  0x2A, 0xC0, 0x03, 0xA8,
-};
-
 const byte CAR_10[2+4*10] = {
   4,10,
 /*{w:16,h:10,bpp:2,brev:1}*/
@@ -200,6 +187,10 @@ const byte CAR_2[2+4*2] = {
   0x01, 0x40,
 };
 
+// pre-shifted CAR_10 with its mask, made with:
+// tools/astrocade/acsprite.py racing.c CAR_10:CAR_10_MASK > racing_pre.s
+extern const PrebakedSprite CAR_10_prebaked;
+
 const byte* const CAR_PATTERNS[16] = {
   CAR_10, CAR_10, CAR_10,
   CAR_9, CAR_9, CAR_8,
@@ -216,18 +207,73 @@ byte get1z(byte x) __z88dk_fastcall {
   return (x<128) ? ZTAB[x] : (255-x)/16+2;
 }
 
+// road center offset for each ground line, per curvature
+// (made by tools/mkroadtab.py)
+#define CURVE_MIN -20
+#define CURVE_MAX 21
+const sbyte ROAD_CURVE[42][45] = {
+{0,0,-1,-1,-1,-1,-2,-2,-3,-3,-4,-5,-6,-7,-8,-9,-10,-11,-12,-14,-15,-17,-19,-20,-22,-24,-26,-28,-30,-32,-34,-37,-39,-42,-44,-47,-50,-53,-55,-58,-61,-65,-68,-71,-74,},
+{0,0,-1,-1,-1,-1,-2,-2,-3,-3,-4,-5,-5,-6,-7,-8,-9,-11,-12,-13,-15,-16,-18,-19,-21,-23,-25,-27,-29,-31,-33,-35,-37,-40,-42,-45,-47,-50,-53,-55,-58,-61,-64,-68,-71,},
+{0,0,-1,-1,-1,-1,-2,-2,-2,-3,-4,-4,-5,-6,-7,-8,-9,-10,-11,-13,-14,-15,-17,-18,-20,-22,-23,-25,-27,-29,-31,-33,-35,-38,-40,-42,-45,-47,-50,-53,-55,-58,-61,-64,-67,},
+{0,0,-1,-1,-1,-1,-1,-2,-2,-3,-3,-4,-5,-6,-7,-7,-8,-10,-11,-12,-13,-14,-16,-17,-19,-20,-22,-24,-26,-27,-29,-31,-33,-36,-38,-40,-42,-45,-47,-50,-52,-55,-58,-60,-63,},
+{0,0,-1,-1,-1,-1,-1,-2,-2,-3,-3,-4,-5,-5,-6,-7,-8,-9,-10,-11,-12,-14,-15,-16,-18,-19,-21,-22,-24,-26,-28,-30,-31,-33,-36,-38,-40,-42,-44,-47,-49,-52,-54,-57,-60,},
+{0,0,-1,-1,-1,-1,-1,-2,-2,-3,-3,-4,-4,-5,-6,-7,-8,-8,-9,-11,-12,-13,-14,-15,-17,-18,-20,-21,-23,-24,-26,-28,-30,-31,-33,-35,-37,-40,-42,-44,-46,-49,-51,-53,-56,},
+{0,0,-1,-1,-1,-1,-1,-2,-2,-2,-3,-4,-4,-5,-5,-6,-7,-8,-9,-10,-11,-12,-13,-14,-16,-17,-18,-20,-21,-23,-24,-26,-28,-29,-31,-33,-35,-37,-39,-41,-43,-45,-48,-50,-52,},
+{0,0,-1,-1,-1,-1,-1,-2,-2,-2,-3,-3,-4,-4,-5,-6,-7,-7,-8,-9,-10,-11,-12,-13,-15,-16,-17,-18,-20,-21,-23,-24,-26,-27,-29,-31,-32,-34,-36,-38,-40,-42,-44,-46,-49,},
+{0,0,-1,-1,-1,-1,-1,-1,-2,-2,-3,-3,-4,-4,-5,-5,-6,-7,-8,-9,-9,-10,-11,-12,-13,-15,-16,-17,-18,-20,-21,-22,-24,-25,-27,-28,-30,-32,-33,-35,-37,-39,-41,-43,-45,},
+{0,0,-1,-1,-1,-1,-1,-1,-2,-2,-2,-3,-3,-4,-4,-5,-6,-6,-7,-8,-9,-10,-10,-11,-12,-13,-14,-16,-17,-18,-19,-20,-22,-23,-25,-26,-28,-29,-31,-32,-34,-36,-37,-39,-41,},
+{0,0,-1,-1,-1,-1,-1,-1,-2,-2,-2,-3,-3,-4,-4,-5,-5,-6,-6,-7,-8,-9,-10,-10,-11,-12,-13,-14,-15,-16,-17,-19,-20,-21,-22,-24,-25,-27,-28,-29,-31,-33,-34,-36,-37,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-3,-3,-4,-4,-5,-5,-6,-7,-7,-8,-9,-9,-10,-11,-12,-13,-14,-15,-16,-17,-18,-19,-20,-21,-23,-24,-25,-27,-28,-29,-31,-32,-34,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-3,-3,-3,-4,-4,-5,-5,-6,-6,-7,-8,-8,-9,-10,-11,-11,-12,-13,-14,-15,-16,-17,-18,-19,-20,-21,-22,-24,-25,-26,-27,-29,-30,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-3,-3,-3,-4,-4,-5,-5,-6,-6,-7,-7,-8,-9,-9,-10,-11,-12,-12,-13,-14,-15,-16,-17,-18,-19,-20,-21,-22,-23,-24,-25,-26,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-2,-3,-3,-3,-4,-4,-5,-5,-5,-6,-6,-7,-8,-8,-9,-9,-10,-11,-11,-12,-13,-14,-14,-15,-16,-17,-18,-19,-20,-21,-22,-23,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-2,-3,-3,-3,-3,-4,-4,-5,-5,-5,-6,-6,-7,-7,-8,-8,-9,-10,-10,-11,-11,-12,-13,-14,-14,-15,-16,-17,-17,-18,-19,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-2,-2,-3,-3,-3,-3,-4,-4,-4,-5,-5,-6,-6,-6,-7,-7,-8,-8,-9,-9,-10,-10,-11,-11,-12,-13,-13,-14,-15,-15,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-2,-2,-3,-3,-3,-3,-3,-4,-4,-4,-5,-5,-5,-6,-6,-6,-7,-7,-7,-8,-8,-9,-9,-10,-10,-11,-11,-12,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-2,-2,-2,-2,-3,-3,-3,-3,-3,-4,-4,-4,-4,-5,-5,-5,-5,-6,-6,-6,-7,-7,-7,-8,-8,},
+{0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-2,-2,-2,-2,-2,-2,-3,-3,-3,-3,-3,-3,-3,-4,-4,-4,-4,-4,},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,3,3,3,3,3,},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,2,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,6,6,6,7,7,},
+{0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,2,2,2,2,2,3,3,3,4,4,4,5,5,5,6,6,6,7,7,8,8,9,9,10,10,11,},
+{0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,2,2,2,2,3,3,3,4,4,5,5,5,6,6,7,7,8,8,9,9,10,10,11,12,12,13,14,14,},
+{0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,4,4,4,5,5,6,6,7,7,8,9,9,10,10,11,12,13,13,14,15,16,16,17,18,},
+{0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,3,3,4,4,4,5,5,6,7,7,8,8,9,10,10,11,12,13,13,14,15,16,17,18,19,20,21,22,},
+{0,0,0,0,0,0,0,0,0,0,1,1,1,2,2,2,3,3,4,4,5,5,6,6,7,8,8,9,10,11,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,},
+{0,0,0,0,0,0,0,0,0,1,1,1,2,2,2,3,3,4,4,5,5,6,7,7,8,9,10,10,11,12,13,14,15,16,17,18,19,20,21,23,24,25,26,28,29,},
+{0,0,0,0,0,0,0,0,0,1,1,1,2,2,3,3,4,4,5,6,6,7,8,8,9,10,11,12,13,14,15,16,17,18,19,20,22,23,24,26,27,28,30,31,33,},
+{0,0,0,0,0,0,0,0,1,1,1,2,2,3,3,4,4,5,5,6,7,8,9,9,10,11,12,13,14,15,16,18,19,20,21,23,24,26,27,28,30,32,33,35,36,},
+{0,0,0,0,0,0,0,0,1,1,1,2,2,3,3,4,5,5,6,7,8,9,9,10,11,12,13,15,16,17,18,19,21,22,24,25,27,28,30,31,33,35,36,38,40,},
+{0,0,0,0,0,0,0,0,1,1,2,2,3,3,4,4,5,6,7,8,8,9,10,11,12,14,15,16,17,19,20,21,23,24,26,27,29,31,32,34,36,38,40,42,44,},
+{0,0,0,0,0,0,0,1,1,1,2,2,3,3,4,5,6,6,7,8,9,10,11,12,14,15,16,17,19,20,22,23,25,26,28,30,31,33,35,37,39,41,43,45,48,},
+{0,0,0,0,0,0,0,1,1,1,2,3,3,4,4,5,6,7,8,9,10,11,12,13,15,16,17,19,20,22,23,25,27,28,30,32,34,36,38,40,42,44,47,49,51,},
+{0,0,0,0,0,0,0,1,1,2,2,3,3,4,5,6,7,7,8,10,11,12,13,14,16,17,19,20,22,23,25,27,29,30,32,34,36,39,41,43,45,48,50,52,55,},
+{0,0,0,0,0,0,0,1,1,2,2,3,4,4,5,6,7,8,9,10,11,13,14,15,17,18,20,21,23,25,27,29,31,33,35,37,39,41,43,46,48,51,53,56,59,},
+{0,0,0,0,0,0,0,1,1,2,2,3,4,5,6,6,7,9,10,11,12,13,15,16,18,19,21,23,25,26,28,30,32,35,37,39,41,44,46,49,51,54,57,59,62,},
+{0,0,0,0,0,0,1,1,1,2,3,3,4,5,6,7,8,9,10,12,13,14,16,17,19,21,22,24,26,28,30,32,34,37,39,41,44,46,49,52,54,57,60,63,66,},
+{0,0,0,0,0,0,1,1,2,2,3,4,4,5,6,7,8,10,11,12,14,15,17,18,20,22,24,26,28,30,32,34,36,39,41,44,46,49,52,54,57,60,63,67,70,},
+{0,0,0,0,0,0,1,1,2,2,3,4,5,6,7,8,9,10,11,13,14,16,18,19,21,23,25,27,29,31,33,36,38,41,43,46,49,52,54,57,60,64,67,70,73,},
+{0,0,0,0,0,0,1,1,2,2,3,4,5,6,7,8,9,11,12,14,15,17,18,20,22,24,26,28,31,33,35,38,40,43,46,48,51,54,57,60,63,67,70,74,77,},
+};
+
 #define PAT_ROAD 0x00
 #define PAT_SKY 0x55
 #define PAT_GROUND 0xaa
 
 byte road_width = 142;
 byte road_cenx = 80;
-int road_inc = 0;
 sbyte road_curve = 0;
 byte curve_dir = 1;
 word track_pos = 0;
 byte speed = 4;
-byte fill_grass = 0;
+
+// skip ground lines whose road has not moved since last frame
+#define DIRTY_SPANS
+
+// left edge of each ground line as last drawn, or one of these:
+#define REDRAW_ROAD 0xfe	// redraw curbs and road
+#define REDRAW_ALL  0xff	// redraw curbs, road and grass
+byte road_x1[GNDH];
 
 // interrupt handler declarations
 void inthandler1() __interrupt;
@@ -300,17 +346,16 @@ Car cars[MAX_CARS];
 
 void draw_car(byte x1, const Car* car) {
   byte x = x1 + car->x;
+  byte redraw = REDRAW_ROAD;
   byte* dest = &vmagic[BOTTOM - car->y][x>>2];
   hw_magic = M_SHIFT(x) | M_OR;
   // is this pattern 16 pixels wide?
   if (car->pattern[0] == 4) {
     // special mask mode for cars near the edge
     if (car->pattern == CAR_10 && (x < 40 || x > 120)) {
-      hw_magic = M_SHIFT(x) | M_OR;
-      fast_sprite_16(CAR_10_MASK, dest);
-      hw_magic = M_SHIFT(x) | M_XOR;
-      fast_sprite_16(CAR_10_INV, dest);
-      fill_grass = 2; // draw over grass next frame
+      // pre-shifted with a mask, so the grass shows through
+      draw_prebaked(&CAR_10_prebaked, x, BOTTOM - car->y);
+      redraw = REDRAW_ALL; // draw over grass next frame
     } else {
       // 16-pixel fast OR with background
       fast_sprite_16(car->pattern, dest);
@@ -319,6 +364,15 @@ void draw_car(byte x1, const Car* car) {
     // 8-pixel fast OR with background
     fast_sprite_8(car->pattern, dest);
   }
+  // car is drawn over this line and the ones below it,
+  // so redraw them next frame
+  {
+    byte y = car->y;
+    byte h = car->pattern[1];
+    do {
+      road_x1[y] = redraw;
+    } while (--h && y--);
+  }
 }
 
 void draw_cars(byte x1, byte y) {
@@ -330,67 +384,65 @@ void draw_cars(byte x1, byte y) {
   }
 }
 
-void draw_grass(byte* start, byte* end) {
-  hw_magic = 0;
-  while (start < end) {
-    *start++ = PAT_GROUND;
-  }
-}
+// fill bytes [from,to) of the current line, bypassing the magic register
+#define FILL_SPAN(from, to, pat) \
+  for (i=(from), dest=vline+i; i<(to); i++) *dest++ = (pat);
+
+// draw a curb through the magic register shifter,
+// with color "left" shifted in before and "right" after
+#define DRAW_CURB(b, x, c0, c1, left, right) \
+  dest = line + (b); \
+  hw_magic = M_SHIFT(x); \
+  WASTER = (left); \
+  *dest++ = (c0); \
+  *dest++ = (c1); \
+  *dest = (right);
 
 void draw_road() {
-  byte y,x1,x2,w,j;
+  byte y,x1,x2,w,i;
   register byte* dest;
-  static byte* line;
-  static word xx;
-  static int inc;
+  static byte* line;	// line in magic area
+  static byte* vline;	// same line in screen RAM
   static const byte* curb;
+  static const sbyte* ofs;
+  static byte b1,b2;
+  static byte ob1;
   curb = CURBS;
+  ofs = ROAD_CURVE[road_curve - CURVE_MIN];
   line = &vmagic[BOTTOM][0];
-  inc = road_inc;
+  vline = &vidmem[BOTTOM][0];
   w = road_width;
-  // 16-bit X coordinate
-  xx = road_cenx << 8;
   // loop from bottom to top
   for (y=0; y<GNDH; y++) {
-    x1 = (xx >> 8) - w/2;
+    x1 = road_cenx + ofs[y] - w/2;
+    ob1 = road_x1[y];
+#ifdef DIRTY_SPANS
+    if (ob1 == x1) goto next;	// nothing moved
+#endif
+    road_x1[y] = x1;
     x2 = x1 + w;
-    // fill in grass?
-    if (fill_grass && y <= PLAYER_Y) {
-      // TODO: calc redundant expr but keeps our register var
-      draw_grass(line, line + x1/4);
-    }
-    // left side of road
-    dest = line + x1/4;
-    hw_magic = M_SHIFT(x1);
-    WASTER = PAT_GROUND;  // fill shifter with ground color
-    *dest++ = curb[0];
-    *dest++ = curb[1];
-    // repave road, unroll loop a bit
-    // (causes a little flicker on the right)
-    for (j=0; j<w/8; j++) {
-      *dest++ = PAT_ROAD;
-      *dest++ = PAT_ROAD;
-    }
-    // right side of road
-    dest = line + x2/4;
-    hw_magic = M_SHIFT(x2);
-    *dest++ = curb[2];
-    *dest++ = curb[3];
-    *dest = PAT_GROUND;
-    // fill in grass?
-    if (fill_grass && y <= PLAYER_Y) {
-      draw_grass(dest, line+40);
+    b1 = x1/4;
+    b2 = x2/4;
+    // a car was drawn over grass?
+    if (ob1 == REDRAW_ALL) {
+      FILL_SPAN(0, b1, PAT_GROUND);
+      FILL_SPAN(b2+3, VBWIDTH, PAT_GROUND);
     }
+    // redraw the whole road
+    DRAW_CURB(b1, x1, curb[0], curb[1], PAT_GROUND, PAT_ROAD);
+    if (b1+3 < b2) fast_fill(vline+b1+3, b2-b1-3, PAT_ROAD);
+    DRAW_CURB(b2, x2, curb[2], curb[3], PAT_ROAD, PAT_GROUND);
+#ifdef DIRTY_SPANS
+next:
+#endif
     // draw any cars which start on this line
-    draw_cars(xx>>8, y);
+    draw_cars(x1 + w/2, y);
     // next line up, update variables
-    line -= 40;
+    line -= VBWIDTH;
+    vline -= VBWIDTH;
     if ((y&3) == 0) curb += 4;
-    xx += inc;
-    inc += road_curve;
     w -= 3;
   }
-  if (fill_grass) fill_grass--;
 }
 
 void draw_sky() {
@@ -445,6 +497,8 @@ void main(void) {
   cars[1].pattern = CAR_6;
   // draw score
   display_string(0, DASH_Y, XPAND_COLORS(1,0), " 00:00");
+  // draw every line on the first frame
+  memset(road_x1, REDRAW_ROAD, sizeof(road_x1));
   // infinite loop
   while (1) {
     position_cars();
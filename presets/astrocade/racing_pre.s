@@ -0,0 +1,549 @@
+; generated by tools/astrocade/acsprite.py -- do not edit
+.area	_CODE
+
+; CAR_10: 4 x 10 bytes
+; magic register: ~2480 cycles
+; _CAR_10_s0: ~903 cycles
+; _CAR_10_s1: ~1005 cycles
+; _CAR_10_s2: ~1133 cycles
+; _CAR_10_s3: ~1005 cycles
+.globl	_CAR_10_prebaked
+_CAR_10_prebaked:
+  .db	5,10
+  .dw	_CAR_10_s0,_CAR_10_s1,_CAR_10_s2,_CAR_10_s3
+_CAR_10_s0:
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ld	bc,#37
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x6a
+  inc	hl
+  ld	(hl),#0xa9
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ld	de,#38
+  add	hl,de
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x29
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x68
+  ld	(hl),a
+  ld	bc,#39
+  add	hl,bc
+  ld	(hl),#0xa7
+  inc	hl
+  ld	(hl),#0xda
+  add	hl,de
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x15
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0xac
+  inc	hl
+  ld	(hl),#0x3a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x54
+  ld	(hl),a
+  ld	bc,#37
+  add	hl,bc
+  ld	(hl),#0x7d
+  inc	hl
+  ld	(hl),#0x95
+  inc	hl
+  ld	(hl),#0x56
+  inc	hl
+  ld	(hl),#0x7d
+  add	hl,bc
+  ld	(hl),#0x55
+  inc	hl
+  ld	(hl),#0x69
+  inc	hl
+  ld	(hl),#0x69
+  inc	hl
+  ld	(hl),#0x55
+  add	hl,bc
+  ld	(hl),#0x55
+  inc	hl
+  ld	(hl),#0xa9
+  inc	hl
+  ld	(hl),#0x6a
+  inc	hl
+  ld	(hl),#0x55
+  add	hl,bc
+  ld	(hl),#0x55
+  inc	hl
+  ld	(hl),#0x80
+  inc	hl
+  ld	(hl),#0x02
+  inc	hl
+  ld	(hl),#0x55
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x15
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0xfc
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x54
+  ld	(hl),a
+  ret
+_CAR_10_s1:
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  inc	hl
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  ld	bc,#38
+  add	hl,bc
+  ld	(hl),#0x5a
+  inc	hl
+  ld	(hl),#0xaa
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x0a
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x5a
+  ld	de,#39
+  add	hl,de
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x29
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0xf6
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x80
+  ld	(hl),a
+  ld	bc,#37
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x6b
+  inc	hl
+  ld	(hl),#0x0e
+  inc	hl
+  ld	(hl),#0x95
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x1f
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x65
+  inc	hl
+  ld	(hl),#0x55
+  inc	hl
+  ld	(hl),#0x9f
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ld	de,#36
+  add	hl,de
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x15
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x5a
+  inc	hl
+  ld	(hl),#0x5a
+  inc	hl
+  ld	(hl),#0x55
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x15
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x6a
+  inc	hl
+  ld	(hl),#0x5a
+  inc	hl
+  ld	(hl),#0x95
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x15
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x60
+  inc	hl
+  ld	(hl),#0x00
+  inc	hl
+  ld	(hl),#0x95
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x40
+  ld	(hl),a
+  inc	hl
+  inc	hl
+  ld	(hl),#0x15
+  ret
+_CAR_10_s2:
+  inc	hl
+  ld	a,(hl)
+  and	#0xc3
+  or	#0x14
+  ld	(hl),a
+  inc	hl
+  inc	hl
+  ld	a,(hl)
+  and	#0xc3
+  or	#0x14
+  ld	(hl),a
+  ld	bc,#38
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x16
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0xaa
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x94
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x02
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x96
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x80
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x0a
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x7d
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0xa0
+  ld	(hl),a
+  ld	de,#37
+  add	hl,de
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x5a
+  inc	hl
+  ld	(hl),#0xc3
+  inc	hl
+  ld	(hl),#0xa5
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ld	bc,#36
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x07
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0xd9
+  inc	hl
+  ld	(hl),#0x55
+  inc	hl
+  ld	(hl),#0x67
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0xd0
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x56
+  inc	hl
+  ld	(hl),#0x96
+  inc	hl
+  ld	(hl),#0x95
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x5a
+  inc	hl
+  ld	(hl),#0x96
+  inc	hl
+  ld	(hl),#0xa5
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x58
+  inc	hl
+  ld	(hl),#0x00
+  inc	hl
+  ld	(hl),#0x25
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x50
+  ld	(hl),a
+  inc	hl
+  inc	hl
+  ld	a,(hl)
+  and	#0xc0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x3f
+  or	#0x40
+  ld	(hl),a
+  ret
+_CAR_10_s3:
+  inc	hl
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  inc	hl
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  ld	bc,#38
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x05
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0xaa
+  inc	hl
+  ld	(hl),#0xa5
+  ld	de,#39
+  add	hl,de
+  ld	(hl),#0xa5
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0xa0
+  ld	(hl),a
+  add	hl,bc
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x02
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x9f
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x68
+  ld	(hl),a
+  add	hl,bc
+  ld	(hl),#0x56
+  inc	hl
+  ld	(hl),#0xb0
+  inc	hl
+  ld	(hl),#0xe9
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  ld	de,#36
+  add	hl,de
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0xf6
+  inc	hl
+  ld	(hl),#0x55
+  inc	hl
+  ld	(hl),#0x59
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0xf4
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x55
+  inc	hl
+  ld	(hl),#0xa5
+  inc	hl
+  ld	(hl),#0xa5
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x54
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x56
+  inc	hl
+  ld	(hl),#0xa5
+  inc	hl
+  ld	(hl),#0xa9
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x54
+  ld	(hl),a
+  add	hl,de
+  ld	a,(hl)
+  and	#0xfc
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	(hl),#0x56
+  inc	hl
+  ld	(hl),#0x00
+  inc	hl
+  ld	(hl),#0x09
+  inc	hl
+  ld	a,(hl)
+  and	#0x03
+  or	#0x54
+  ld	(hl),a
+  ld	bc,#37
+  add	hl,bc
+  ld	(hl),#0x54
+  inc	hl
+  inc	hl
+  ld	a,(hl)
+  and	#0xf0
+  or	#0x01
+  ld	(hl),a
+  inc	hl
+  ld	a,(hl)
+  and	#0x0f
+  or	#0x50
+  ld	(hl),a
+  ret
@@ -21,15 +21,47 @@ const byte slot0 = 0;
 #endif
 
 
+// estimated MARIA DMA cycles per scanline (line is 454 cycles)
+#define DMA_HEADER4	8	// 4-byte DL header
+#define DMA_HEADER5	10	// 5-byte DL header
+#define DMA_DIRECT	3	// per byte of direct graphics
+#define DMA_INDIRECT	9	// per double-byte indirect character
+#define DMA_BUDGET	300	// max DMA cycles per line we'll allow in a zone
+
 byte DL[NUMSLOTS][SLOTSIZE];
 byte DL_len[NUMSLOTS];
+word DL_dma[NUMSLOTS];	// estimated DMA cycles per line in each zone
+byte DL_keep[NUMSLOTS];	// length of static entries at start of list
+word DL_keepdma[NUMSLOTS]; // DMA cycles of static entries
+byte DL_dirty[NUMSLOTS]; // list has entries added since dll_clear()
 DLLEntry DLL[NUMSLOTS];
 
+byte dll_overflow;	// entries refused since last dll_clear()
+
+// remove the dynamic entries from the current buffer's dirty zones
 void dll_clear() {
+  byte i;
+  byte* dl = DL[slot0];
+  for (i=slot0; i<slot0+16; i++, dl += SLOTSIZE) {
+    if (DL_dirty[i]) {
+      byte keep = DL_keep[i];
+      DL_len[i] = keep;
+      DL_dma[i] = DL_keepdma[i];
+      dl[keep+1] = 0;
+      DL_dirty[i] = 0;
+    }
+  }
+  dll_overflow = 0;
+}
+
+// make everything in the current buffer static, so dll_clear() keeps it
+// (with DOUBLEBUFFER, add static entries to both buffers)
+void dll_keep() {
   byte i;
   for (i=slot0; i<slot0+16; i++) {
-    DL[i][1] = 0;
-    DL_len[i] = 0;
+    DL_keep[i] = DL_len[i];
+    DL_keepdma[i] = DL_dma[i];
+    DL_dirty[i] = 0;
   }
 }
 
@@ -46,37 +78,67 @@ void dll_swap() {
 }
 #endif
 
-void* dll_alloc(byte slot, byte len) {
+// returns NULL (and counts the overflow) if the zone's list is full
+// or the entry would push the zone over its DMA budget
+void* dll_alloc(byte slot, byte len, word dma) {
   byte dlofs;
   slot &= NUMSLOTS-1;
   dlofs = DL_len[slot];
+  // need len bytes plus 2 for the terminating header
+  if (dlofs+len+2 > SLOTSIZE || DL_dma[slot]+dma > DMA_BUDGET) {
+    dll_overflow++;
+    return NULL;
+  }
   DL_len[slot] += len;
+  DL_dma[slot] += dma;
+  DL_dirty[slot] = 1;
   DL[slot][dlofs+len+1] = 0;
   return &DL[slot][dlofs];
 }
 
-void dll_add_sprite(word addr, byte x, byte y, byte wpal) {
+// remove the last entry allocated in a zone
+void dll_unalloc(byte slot, byte len, word dma) {
+  slot &= NUMSLOTS-1;
+  DL_len[slot] -= len;
+  DL_dma[slot] -= dma;
+  DL[slot][DL_len[slot]+1] = 0;
+}
+
+byte dll_add_sprite(word addr, byte x, byte y, byte wpal) {
   byte slot = (y >> 4) | slot0;
-  register DL4Entry* dl = (DL4Entry*) dll_alloc(slot, 4);
+  word dma = DMA_HEADER4 + (32-(wpal&31))*DMA_DIRECT;
+  register DL4Entry* dl = (DL4Entry*) dll_alloc(slot, 4, dma);
+  if (!dl) return 0;
   dl->data_lo = (byte)addr;
   dl->data_hi = (byte)(addr>>8) + (y & 15);
   dl->xpos = x;
   dl->width_pal = wpal;
-  if (y & 15) {
-    DL4Entry* dl2 = (DL4Entry*) dll_alloc(slot+1, 4);
+  // the bottom half goes in the next zone, unless this is the last one
+  // (slot+1 would be in the other buffer)
+  if ((y & 15) && (slot & 15) != 15) {
+    DL4Entry* dl2 = (DL4Entry*) dll_alloc(slot+1, 4, dma);
+    // don't leave half a sprite on the screen
+    if (!dl2) {
+      dll_unalloc(slot, 4, dma);
+      return 0;
+    }
     *dl2 = *dl;
     dl2->data_hi -= SLOTHEIGHT;
   }
+  return 1;
 }
 
-void dll_add_string(const char* str, byte x, byte y, byte wpal) {
+byte dll_add_string(const char* str, byte x, byte y, byte wpal) {
   byte slot = (y >> 4) | slot0;
-  register DL5Entry* dl = (DL5Entry*) dll_alloc(slot, 5);
+  word dma = DMA_HEADER5 + (32-(wpal&31))*DMA_INDIRECT;
+  register DL5Entry* dl = (DL5Entry*) dll_alloc(slot, 5, dma);
+  if (!dl) return 0;
   dl->data_lo = (byte)str;
   dl->data_hi = (word)str>>8;
   dl->flags = DL5_INDIRECT;
   dl->width_pal = wpal;
   dl->xpos = x;
+  return 1;
 }
 
 void dll_setup() {
@@ -90,6 +152,7 @@ void dll_setup() {
     dlptr += sizeof(DL[0]);
     dll++;
   }
+  memset(DL_dirty, 1, sizeof(DL_dirty));
   dll_clear();
 #ifdef DOUBLEBUFFER
   dll_swap();
@@ -99,9 +162,21 @@ void dll_setup() {
 
 char* hello = "\2\4\6\0\220\222\102";
 
+word frame_idle;	// wait loop iterations before last frame's vblank
+
+#define NUM_OBJECTS 16
+
+void add_object(byte i, byte y) {
+  if (i < 8)
+    dll_add_sprite(0xa068, i*4, i*16+y, DL_WP(4,1));
+  else
+    dll_add_sprite(0xa06c, (i-8)*8+y, (i-8)*16, DL_WP(4,1));
+}
+
 void main() {
   byte i;
   byte y = 0;
+  byte first = 0;
 
   dll_setup();
   
@@ -118,15 +193,34 @@ void main() {
   MARIA.P1C3 = 0x1f;
   MARIA.BACKGRND = 0;
 
+  // static entries are only added once
+  dll_add_string(hello, 48, 176, DL_WP(8,0));
+  dll_keep();
+#ifdef DOUBLEBUFFER
+  dll_swap();
+  dll_add_string(hello, 48, 176, DL_WP(8,0));
+  dll_keep();
+#endif
+
   while (1) {
-    while ((MARIA.MSTAT & MSTAT_VBLANK) == 0) ;
+    // count how much CPU time was left over
+    frame_idle = 0;
+    while ((MARIA.MSTAT & MSTAT_VBLANK) == 0) frame_idle++;
+#ifdef DOUBLEBUFFER
     dll_swap();
+#endif
+    // if objects were dropped last frame, start with a different one
+    // so that a crowded zone flickers instead of losing the same objects
+    if (dll_overflow) {
+      if (++first >= NUM_OBJECTS) first = 0;
+    }
     dll_clear();
     dll_add_string(hello, y+32, 32, DL_WP(8,0));
-    for (i=0; i<8; i++) {
-      dll_add_sprite(0xa068, i*4, i*16+y, DL_WP(4,1));
-      dll_add_sprite(0xa06c, i*8+y, i*16, DL_WP(4,1));
-    }
+    i = first;
+    do {
+      add_object(i, y);
+      if (++i >= NUM_OBJECTS) i = 0;
+    } while (i != first);
     while ((MARIA.MSTAT & MSTAT_VBLANK) != 0) ;
     y++;
   }
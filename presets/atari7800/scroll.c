@@ -40,6 +40,7 @@ byte DL_len[NUMSLOTS];
 
 #ifdef DLSAVE
 byte DL_save[NUMSLOTS];
+byte DL_dirty[NUMSLOTS]; // list has entries added since dll_save()
 #endif
 
 void dll_set_addr(const void* dpp) {
@@ -58,13 +59,18 @@ void dll_clear() {
 #ifdef DLSAVE
 void dll_save() {
   memcpy(DL_save, DL_len, sizeof(DL_save));
+  memset(DL_dirty, 0, sizeof(DL_dirty));
 }
 
+// only lists that were added to need restoring
 void dll_restore() {
   byte i;
-  memcpy(DL_len, DL_save, sizeof(DL_save));
   for (i=0; i<NUMSLOTS; i++) {
-    DL[i][DL_len[i]+1] = 0;
+    if (DL_dirty[i]) {
+      DL_len[i] = DL_save[i];
+      DL[i][DL_len[i]+1] = 0;
+      DL_dirty[i] = 0;
+    }
   }
 }
 #endif
@@ -95,6 +101,9 @@ void* dll_alloc(byte slot, byte len) {
   slot &= NUMSLOTS-1;
   dlofs = DL_len[slot];
   DL_len[slot] += len;
+#ifdef DLSAVE
+  DL_dirty[slot] = 1;
+#endif
   DL[slot][dlofs+len+1] = 0;
   return &DL[slot][dlofs];
 }
@@ -142,6 +151,7 @@ void dll_setup() {
 #endif
 #ifdef DLSAVE
   memset(DL_save, 0, sizeof(DL_save));
+  memset(DL_dirty, 0, sizeof(DL_dirty));
 #endif
 }
 
@@ -149,6 +159,8 @@ void dll_setup() {
 
 char* hello = "\2\4\6\0\220\222\102";
 
+word frame_idle;	// wait loop iterations before last frame's vblank
+
 void main() {
   byte i;
   byte y = 0;
@@ -180,7 +192,9 @@ void main() {
   dll_save();
 
   while (1) {
-    while ((MARIA.MSTAT & MSTAT_VBLANK) == 0) ;
+    // count how much CPU time was left over
+    frame_idle = 0;
+    while ((MARIA.MSTAT & MSTAT_VBLANK) == 0) frame_idle++;
     dll_set_scroll(y);
     dll_restore();
     dll_add_sprite(0xa06c, y, y, DL_WP(4,1));
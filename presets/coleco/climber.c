@@ -12,6 +12,12 @@ For more information, see "Making Games for the NES".
 #include "common.h"
 //#link "common.c"
 
+#include "vramqueue.h"
+//#link "vramqueue.c"
+
+#include "spritemux.h"
+//#link "spritemux.c"
+
 // for SMS
 //#link "fonts.s"
 
@@ -133,6 +139,35 @@ const byte sprite_table[NUM_SPRITE_PATTERNS*2][16*2] = {
   }
 };
 
+// blimp and sprite_table mirrored, rerun this after editing them
+// python3 tools/bakepatterns.py --flip presets/coleco/climber.c blimp_sprite_table sprite_table -n flipped_sprite_table
+// 448 bytes, 364 packed
+const byte flipped_sprite_table[364] = {
+  0x0e,0x0f,0x07,0x03,0x01,0x03,0x04,0xff,0xff,0x04,0x03,0x01,0x03,0x07,0x0f,0x81,
+  0x00,0x04,0x80,0xc0,0xe7,0xff,0x82,0x7f,0x04,0xff,0xe7,0xc0,0x80,0x82,0x00,0x19,
+  0x07,0x7f,0xfc,0xfd,0xfd,0xfc,0xfd,0xfd,0xfc,0xff,0x7f,0x07,0x88,0x70,0x80,0x3f,
+  0xff,0xff,0x6f,0xaf,0xaf,0x6f,0xaf,0xaf,0x61,0x81,0xff,0x03,0x3f,0x02,0x01,0x81,
+  0xff,0x04,0x5d,0x49,0x55,0x55,0x81,0x5d,0x82,0xff,0x09,0x10,0xe0,0x00,0xf8,0xff,
+  0x1f,0x6f,0x6f,0x1f,0x81,0x7f,0x03,0xff,0xff,0xf8,0x83,0x00,0x02,0xe0,0xfe,0x84,
+  0xff,0x02,0xfe,0xe0,0x86,0x00,0x06,0xc0,0xe0,0xe0,0xfe,0xe0,0xc0,0x84,0x00,0x01,
+  0x03,0x81,0x05,0x06,0x03,0x00,0x01,0x01,0x0f,0x07,0x81,0x01,0x81,0x00,0x01,0xc0,
+  0x81,0xe0,0x02,0xc0,0x00,0x81,0xf0,0x81,0xe0,0x0b,0xf0,0xf0,0x40,0x00,0x03,0x07,
+  0x37,0x37,0x32,0x1c,0x0c,0x81,0x04,0x02,0x0f,0x0e,0x82,0x00,0x01,0xc0,0x81,0xe0,
+  0x0d,0x40,0x20,0x30,0x38,0x38,0x28,0xe0,0x60,0x70,0x70,0x00,0x00,0x03,0x81,0x05,
+  0x09,0x03,0x00,0x19,0x1f,0x0f,0x01,0x01,0x07,0x0f,0x81,0x00,0x01,0xc0,0x81,0xe0,
+  0x02,0xc0,0x00,0x81,0xf0,0x14,0xe0,0xe0,0xf0,0xf0,0x30,0x30,0x00,0x03,0x04,0x06,
+  0x06,0x03,0x40,0x67,0x3c,0x1d,0x04,0x07,0x07,0x0e,0x81,0x00,0x0d,0xc0,0x20,0x60,
+  0x60,0xc2,0x06,0xfc,0x38,0xa0,0x20,0xe0,0xf0,0x38,0x81,0x00,0x01,0x03,0x81,0x05,
+  0x05,0x03,0x00,0x19,0x0d,0x07,0x82,0x01,0x04,0x03,0x00,0x00,0xc0,0x81,0xe0,0x02,
+  0xc0,0x00,0x81,0xf0,0x05,0xe2,0xe2,0xf0,0xf8,0x98,0x8e,0x00,0x02,0x01,0x03,0x83,
+  0x00,0x01,0xec,0x82,0x0c,0x82,0x00,0x02,0xb0,0xb0,0x82,0x00,0x01,0x01,0x83,0x03,
+  0x04,0x00,0x00,0x0c,0x1c,0x84,0x00,0x01,0x80,0x83,0xc0,0x82,0x00,0x02,0x30,0x38,
+  0x8b,0x00,0x02,0x0c,0x1c,0x84,0x00,0x01,0xec,0x82,0x0c,0x81,0x00,0x03,0x0c,0x0c,
+  0x04,0x83,0x00,0x05,0x03,0x00,0x03,0x02,0x03,0x81,0x00,0x02,0x0c,0x1c,0x84,0x00,
+  0x05,0xc0,0x00,0xc0,0x40,0xc0,0x81,0x00,0x02,0x18,0x1c,0x8d,0x00,0x02,0x03,0x07,
+  0x83,0x00,0x01,0xec,0x82,0x0c,0x82,0x00,0x02,0x98,0x30,0x00,
+};
+
 ///
 
 typedef struct Level {
@@ -288,6 +323,22 @@ typedef struct Actor {
 
 Actor actors[MAX_ACTORS];
 
+// two sprites per actor, then the blimp
+#define BLIMP_SPRITE (MAX_ACTORS*2)
+#define NSPRITES (BLIMP_SPRITE+4)
+
+struct cvu_sprite vsprites[NSPRITES];
+
+void set_sprite(byte i, const struct cvu_sprite* sprite) {
+  memcpy(&vsprites[i], sprite, sizeof(struct cvu_sprite));
+}
+
+// the sprites go out with the VRAM queue right after the vsync
+void wait_for_frame() {
+  wait_vsync();
+  vq_flush();
+}
+
 void create_actors_on_level(byte level_index) {
   byte actor_index = (level_index % (MAX_ACTORS-1)) + 1;
   struct Actor* a = &actors[actor_index];
@@ -335,10 +386,10 @@ void draw_actor(byte i) {
   } else {
     sprite.x += XOFS;
   }
-  cvu_set_sprite(SPRITES, i*2, &sprite);
+  set_sprite(i*2, &sprite);
   sprite.name += NUM_SPRITE_PATTERNS*4;
   sprite.tag ^= a->color1 ^ a->color2;
-  cvu_set_sprite(SPRITES, i*2+1, &sprite);
+  set_sprite(i*2+1, &sprite);
   a->onscreen = 1;
 }
 
@@ -346,10 +397,11 @@ void refresh_actors() {
   byte i;
   for (i=0; i<MAX_ACTORS; i++)
     draw_actor(i);
+  spritemux_update();
 }
 
 void refresh_screen() {
-  wait_vsync();
+  wait_for_frame();
   draw_screen();
   refresh_actors();
 }
@@ -385,7 +437,7 @@ byte mount_ladder(Actor* player, signed char level_adjust) {
 }
 
 void check_scroll_up() {
-  byte player_screen_y = cvu_vinb(SPRITES + 0); // sprite Y pos
+  byte player_screen_y = vsprites[0].y; // sprite Y pos
   if (player_screen_y < 192/2-4) {
     scroll_y++;
     refresh_screen();
@@ -394,7 +446,7 @@ void check_scroll_up() {
 }
 
 void check_scroll_down() {
-  byte player_screen_y = cvu_vinb(SPRITES + 0); // sprite Y pos
+  byte player_screen_y = vsprites[0].y; // sprite Y pos
   if (player_screen_y > 192/2+4 && scroll_y > 0) {
     scroll_y--;
     refresh_screen();
@@ -519,32 +571,31 @@ bool check_collision(Actor* a) {
 void preview_stage() {
   scroll_y = levels[MAX_LEVELS-1].ypos;
   while (scroll_y > 0) {
-    wait_vsync();
+    wait_for_frame();
     refresh_screen();
-    refresh_actors();
     scroll_y--;
   }
 }
 
 void draw_blimp(struct cvu_sprite* sprite) {
   sprite->name = 48;
-  wait_vsync();
-  cvu_set_sprite(SPRITES, 28, sprite);
+  wait_for_frame();
+  set_sprite(BLIMP_SPRITE, sprite);
   sprite->name += 4;
   sprite->x += 16;
-  cvu_set_sprite(SPRITES, 29, sprite);
+  set_sprite(BLIMP_SPRITE+1, sprite);
   sprite->name += 4;
   sprite->x += 16;
-  cvu_set_sprite(SPRITES, 30, sprite);
+  set_sprite(BLIMP_SPRITE+2, sprite);
   sprite->name += 4;
   sprite->x += 16;
-  cvu_set_sprite(SPRITES, 31, sprite);
+  set_sprite(BLIMP_SPRITE+3, sprite);
   refresh_actors();
 }
 
 void blimp_pickup_scene() {
   struct cvu_sprite sprite;
-  byte player_screen_y = cvu_vinb(SPRITES + 0); // sprite Y pos
+  byte player_screen_y = vsprites[0].y; // sprite Y pos
   sprite.x = actors[0].x-14;
   sprite.y = 240;
   sprite.tag = 0x8f;
@@ -577,7 +628,7 @@ void play_scene() {
   refresh_screen();
   
   while (actors[0].level != MAX_LEVELS-1) {
-    wait_vsync();
+    wait_for_frame();
     refresh_actors();
     move_player();
     // move all the actors
@@ -609,13 +660,17 @@ void setup_graphics() {
 #endif
 
   cvu_memtovmemcpy(SPRITE_PATTERNS, sprite_table, sizeof(sprite_table));
-  flip_sprite_patterns(SPRITE_PATTERNS + 512, (const byte*)sprite_table, sizeof(sprite_table));
-  flip_sprite_patterns(SPRITE_PATTERNS + 384, (const byte*)blimp_sprite_table, sizeof(blimp_sprite_table));
+  rle_to_vram(flipped_sprite_table, SPRITE_PATTERNS + 384);
 }
 
 void main() {
+  byte i;
   vdp_setup();
   setup_graphics();
+  for (i=0; i<NSPRITES; i++)
+    vsprites[i].y = SPRITEMUX_OFF;
+  vq_init();
+  spritemux_init(SPRITES, vsprites, NSPRITES);
   cv_set_screen_active(true);
   cv_set_vint_handler(&vint_handler);  
   make_levels();
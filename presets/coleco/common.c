@@ -124,6 +124,27 @@ void set_shifted_pattern(const byte* src, word dest, byte shift) {
   }
 }
 
+// unpack RLE data from tools/bakepatterns.py into VRAM:
+// 0 = end, 1-127 = that many bytes follow,
+// 128-255 = the next byte 2-129 times
+void rle_to_vram(const byte* src, word dest) {
+  byte n;
+  cv_set_write_vram_address(dest);
+  while ((n = *src++)) {
+    if (n & 0x80) {
+      byte b = *src++;
+      n = (n & 0x7f) + 2;
+      do {
+        cv_graphics_port = b;
+      } while (--n);
+    } else {
+      do {
+        cv_graphics_port = *src++;
+      } while (--n);
+    }
+  }
+}
+
 void copy_default_character_set() {
 #ifdef CV_MSX
   static byte __at(0xf91f) CGPNT;
@@ -76,6 +76,7 @@ extern word bcd_add(word a, word b);
 
 extern void vdp_setup();
 extern void set_shifted_pattern(const byte* src, word dest, byte shift);
+extern void rle_to_vram(const byte* src, word dest);
 
 extern void copy_default_character_set();
 
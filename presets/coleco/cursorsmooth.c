@@ -2,6 +2,8 @@
 /*
 This demo animates two 16 x 16 sprites.
 It also uses the collision detection bit.
+The sprite records are queued with vq_memtovmemcpy() and
+written by the NMI handler, so the main loop never waits on the VDP.
 */
 
 #include <stdint.h>
@@ -9,6 +11,9 @@ It also uses the collision detection bit.
 #include <cv.h>
 #include <cvu.h>
 
+//#link "vramqueue.c"
+#include "vramqueue.h"
+
 // number of sprite patterns
 #define NUM_SPRITE_PATTERNS 1
 
@@ -26,6 +31,7 @@ volatile bool vblank;
 
 // NMI handler routine.
 void nmi(void) {
+  vq_flush();	// write what the main loop queued last frame
   vblank = true;
 }
 
@@ -125,6 +131,7 @@ void main(void)
   cv_set_screen_active(true);
 
   // Set NMI handler so we can detect VBLANK.
+  vq_init();
   cv_set_vint_handler(nmi);
   // Set background color
   cv_set_colors(0, CV_COLOR_BLUE);
@@ -138,8 +145,9 @@ void main(void)
     // Move both cursors by their corresponding joystick.
     move_cursor(&s, 0);
     move_cursor(&s2, 1);
-    // Update VRAM with new sprite records.
-    cvu_set_sprite(SPRITES, 0, &s);
-    cvu_set_sprite(SPRITES, 1, &s2);
+    // Queue the new sprite records for the next NMI.
+    // s and s2 are only changed again after it has run.
+    vq_memtovmemcpy(SPRITES + 0*4, &s, 4);
+    vq_memtovmemcpy(SPRITES + 1*4, &s2, 4);
   }
 }
@@ -4,6 +4,10 @@ Demonstrates playing multi-voice music on the SN76489A PSG
 using the CVLib functions.
 
 Similar to the music example in "Making Arcade Games in C".
+
+The player sets every voice each frame, but it goes through
+the register shadows in sound.c, so the PSG only gets written
+when a volume or pitch actually changes.
 */
 
 #include <stdlib.h>
@@ -11,6 +15,9 @@ Similar to the music example in "Making Arcade Games in C".
 #include <cv.h>
 #include <cvu.h>
 
+//#link "sound.c"
+#include "sound.h"
+
 typedef unsigned char byte;
 typedef unsigned short word;
 
@@ -21,10 +28,10 @@ typedef unsigned short word;
 void music_start(const byte* music);
 void music_update();
 
-// Namespace(bias=0, freq=1789772.5, length=64, maxbits=15.0, upper=49)
-// 437.0 459.515928524 49
-const int note_table[64] = {
-17356, 32764, 30926, 29190, 27551, 26005, 24546, 23168, 21868, 20640, 19482, 18388, 17356, 32765, 30926, 29190, 27552, 26005, 24546, 23168, 21868, 20640, 19482, 18389, 17357, 16382, 15463, 14595, 13776, 13003, 12273, 11584, 10934, 10320, 9741, 9194, 8678, 8191, 7731, 7298, 6888, 6501, 6136, 5792, 5467, 5160, 4871, 4597, 4339, 4096, 3866, 3649, 3444, 3251, 3068, 2896, 2733, 2580, 2435, 2299, 2170, 2048, 1933, 1824, };
+// python3 tools/mknotes.py --clock 3579545 -m 10 -t "const word"
+// 437.4 2302.489968499732 49
+const word note_table[64] = {
+541,1023,965,911,860,812,766,723,682,644,608,574,542,1023,965,911,860,812,766,723,682,644,608,574,542,1023,966,911,860,812,766,723,683,644,608,574,542,511,483,456,430,406,383,362,341,322,304,287,271,256,241,228,215,203,192,181,171,161,152,144,135,128,121,114,};
 
 struct {
   byte volume;
@@ -45,7 +52,7 @@ void music_update() {
   byte freech = 0;
   for (ch=0; ch<num_voices; ch++) {
     if (voice[ch].volume) {
-      cv_set_attenuation(CV_SOUNDCHANNEL_0+ch*2, 32-voice[ch].volume--);
+      sound_attenuation[ch] = (32-voice[ch].volume--) >> 1;
     } else {
       freech = ch;
     }
@@ -55,9 +62,8 @@ void music_update() {
     while (cur_duration == 0) {
       byte note = next_music_byte();
       if ((note & 0x80) == 0) {
-        int period = note_table[note & 63];
-        cv_set_attenuation(CV_SOUNDCHANNEL_0+ch*2, 32);
-        cv_set_frequency(CV_SOUNDCHANNEL_0+ch*2, period);
+        sound_attenuation[ch] = SOUND_OFF;
+        sound_period[ch] = note_table[note & 63];
         voice[ch].volume = 31;
         ch = ch ? ch-1 : num_voices-1;
       } else {
@@ -87,11 +93,13 @@ const byte music1[] = {
 
 void vint_handler(void) {
   cv_set_colors(CV_COLOR_BLACK, CV_COLOR_BLUE);
+  sound_update();
   music_update();
   cv_set_colors(CV_COLOR_BLACK, CV_COLOR_BLACK);
 }
 
 void main(void) {
+  sound_init();
   cv_set_vint_handler(vint_handler);
   cv_set_screen_active(true);
   while (1) {
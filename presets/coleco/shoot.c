@@ -15,20 +15,45 @@ For more information, see "Making Arcade Games in C".
 #include "stars.h"
 //#link "stars.c"
 
+#include "vramqueue.h"
+//#link "vramqueue.c"
+
+#include "spritemux.h"
+//#link "spritemux.c"
+
 // for SMS
 //#link "fonts.s"
 
 #define NSPRITES 16
 #define NMISSILES 8
-#define YOFFSCREEN 239
+#define YOFFSCREEN 239	// missile Y when not in flight (game logic only)
 
-static byte pattern_table[8*2] = {
+// the enemy, baked into pattern_table_shifted below
+const byte pattern_table[8*2] = {
   /*{w:16,h:8,brev:1,remap:[-4,0,1,2]}*/
   0xCC, 0xF2, 0xD0, 0xFC, 0xF3, 0xE8, 0xC4, 0x03,
   0x0C, 0x13, 0x02, 0x0F, 0x33, 0x05, 0x08, 0x30,
 };
 
-static byte sprite_table[][16*2] = {
+// pre-shifted 0-7 pixels, rerun this after editing the enemy
+// python3 tools/bakepatterns.py --shift presets/coleco/shoot.c pattern_table
+// 192 bytes, 177 packed
+const byte pattern_table_shifted[177] = {
+  0x10,0x0c,0x13,0x02,0x0f,0x33,0x05,0x08,0x30,0xcc,0xf2,0xd0,0xfc,0xf3,0xe8,0xc4,
+  0x03,0x86,0x00,0x10,0x06,0x09,0x01,0x07,0x19,0x02,0x04,0x18,0x66,0xf9,0x68,0xfe,
+  0xf9,0xf4,0x62,0x01,0x82,0x00,0x4c,0x80,0x00,0x00,0x80,0x03,0x04,0x00,0x03,0x0c,
+  0x01,0x02,0x0c,0x33,0xfc,0xb4,0xff,0xfc,0x7a,0x31,0x00,0x00,0x80,0x00,0x00,0xc0,
+  0x00,0x00,0xc0,0x01,0x02,0x00,0x01,0x06,0x00,0x01,0x06,0x99,0x7e,0x5a,0xff,0x7e,
+  0xbd,0x18,0x00,0x80,0x40,0x00,0x80,0x60,0x00,0x80,0x60,0x00,0x01,0x00,0x00,0x03,
+  0x00,0x00,0x03,0xcc,0x3f,0x2d,0xff,0x3f,0x5e,0x8c,0x00,0xc0,0x20,0x00,0xc0,0x30,
+  0x80,0x40,0x30,0x82,0x00,0x14,0x01,0x00,0x00,0x01,0x66,0x9f,0x16,0x7f,0x9f,0x2f,
+  0x46,0x80,0x60,0x90,0x80,0xe0,0x98,0x40,0x20,0x18,0x86,0x00,0x10,0x33,0x4f,0x0b,
+  0x3f,0xcf,0x17,0x23,0xc0,0x30,0xc8,0x40,0xf0,0xcc,0xa0,0x10,0x0c,0x86,0x00,0x10,
+  0x19,0x27,0x05,0x1f,0x67,0x0b,0x11,0x60,0x98,0xe4,0xa0,0xf8,0xe6,0xd0,0x88,0x06,
+  0x00,
+};
+
+const byte sprite_table[][16*2] = {
   /*{w:16,h:16,brev:1,remap:[4,0,1,2,3,5,6,7,8,9],count:15}*/ 
   {
   0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
@@ -152,7 +177,8 @@ typedef struct {
 FormationEnemy formation[MAX_IN_FORMATION];
 AttackingEnemy attackers[MAX_ATTACKERS];
 Missile missiles[NMISSILES];
-struct cvu_sprite vsprites[NSPRITES];
+// the missiles go after the other sprites
+struct cvu_sprite vsprites[NSPRITES+NMISSILES];
 
 byte formation_offset_x;
 signed char formation_direction;
@@ -167,17 +193,13 @@ word framecount;
 
 void copy_sprites() {
   byte i;
-  word ofs;
-  cvu_memtovmemcpy(SPRITES, vsprites, sizeof(vsprites));
-  // copy all "shadow missiles" to video memory
-  ofs = SPRITES + NSPRITES*4;
+  // copy all "shadow missiles" to their sprites
+  // (parked ones at SPRITEMUX_OFF, so the multiplexer leaves them out)
   for (i=0; i<NMISSILES; i++) {
-    // sprite struct: {y, x, name, tag}
-    cv_set_write_vram_address(ofs);
-    cv_voutb(missiles[i].ypos);
-    cv_voutb(missiles[i].xpos);
-    ofs += 4;
+    vsprites[NSPRITES+i].y = missiles[i].ypos == YOFFSCREEN ? SPRITEMUX_OFF : missiles[i].ypos;
+    vsprites[NSPRITES+i].x = missiles[i].xpos;
   }
+  spritemux_update();
 }
 
 void add_score(word bcd) {
@@ -188,17 +210,13 @@ void add_score(word bcd) {
 
 void clrobjs() {
   byte i;
-  word ofs;
   memset(vsprites, 0, sizeof(vsprites));
   for (i=0; i<NSPRITES; i++) {
-    vsprites[i].y = YOFFSCREEN;
+    vsprites[i].y = SPRITEMUX_OFF;
   }
-  ofs = SPRITES + NSPRITES*4;
   for (i=0; i<NMISSILES; i++) {
-    // sprite struct: {y, x, name, tag}
-    cvu_voutb(i == 7 ? 4 : 8, ofs+2);
-    cvu_voutb(CV_COLOR_WHITE, ofs+3);
-    ofs += 4;
+    vsprites[NSPRITES+i].name = i == 7 ? 4 : 8;
+    vsprites[NSPRITES+i].tag = CV_COLOR_WHITE;
     missiles[i].ypos = YOFFSCREEN;
   }
 }
@@ -307,7 +325,7 @@ void draw_attacker(byte i) {
     vsprites[i].y = a->y >> 8;
     vsprites[i].tag = COLOR_ATTACKER;
   } else {
-    vsprites[i].y = YOFFSCREEN;
+    vsprites[i].y = SPRITEMUX_OFF;
   }
 }
 
@@ -455,7 +473,7 @@ void animate_enemy_explosion() {
     // animate next frame
     if (enemy_exploding >= 8) {
       enemy_exploding = 0; // hide explosion after 4 frames
-      vsprites[6].y = YOFFSCREEN;
+      vsprites[6].y = SPRITEMUX_OFF;
     } else {
       vsprites[6].name = SPRI_EXPLODE + (enemy_exploding += 4); // TODO
     }
@@ -466,7 +484,7 @@ void animate_player_explosion() {
   byte z = player_exploding;
   if (z <= 3) {
     if (z == 3) {
-      vsprites[7].y = YOFFSCREEN;
+      vsprites[7].y = SPRITEMUX_OFF;
     } else {
       vsprites[7].name = SPRI_EXPLODE + z*4;
     }
@@ -589,8 +607,12 @@ void set_sounds() {
   }
 }
 
+// the game writes VRAM itself, so the queued sprites and starfield
+// updates go out here, at the start of the vertical blank, rather
+// than in the vint handler
 void wait_for_frame() {
-  while (((vint_counter ^ framecount) & 3) == 0);
+  wait_vsync();
+  vq_flush();
 }
 
 void play_round() {
@@ -643,19 +665,19 @@ PATTERN TABLE:
 */
 
 void setup_graphics() {
-  byte i;
   copy_default_character_set();
   cvu_memtovmemcpy(SPRITE_PATTERNS, sprite_table, sizeof(sprite_table));
   cvu_vmemset(COLOR, COLOR_SCORE<<4, 8); // set color for chars 0-63
   cvu_vmemset(COLOR+8, COLOR_FORMATION<<4, 32-8); // set chars 63-255
-  for (i=0; i<8; i++)
-    set_shifted_pattern(pattern_table, PATTERN+67*8+i*3*8, i);
+  rle_to_vram(pattern_table_shifted, PATTERN+67*8);
 }
 
 void main() {
   vdp_setup();
   setup_graphics();
   clrscr();
+  vq_init();
+  spritemux_init(SPRITES, vsprites, NSPRITES+NMISSILES);
   starfield_setup();
   cv_set_vint_handler(&vint_handler);
   cv_set_screen_active(true);
@@ -0,0 +1,179 @@
+
+#include <string.h>
+#include <cv.h>
+
+#include "sound.h"
+
+#pragma opt_code_speed
+
+#ifdef CV_CV
+__sfr __at (0xff) psg_port;
+#endif
+#ifdef CV_SMS
+__sfr __at (0x7f) psg_port;
+#endif
+
+uint16_t sound_period[SOUND_VOICES];
+uint8_t sound_attenuation[SOUND_VOICES+1];
+uint8_t sound_noise;
+
+// what the chip has now
+static uint16_t chip_period[SOUND_VOICES];
+static uint8_t chip_attenuation[SOUND_VOICES+1];
+static uint8_t chip_noise;
+
+void sound_init() {
+  memset(sound_period, 0, sizeof(sound_period));
+  memset(sound_attenuation, SOUND_OFF, sizeof(sound_attenuation));
+  sound_noise = 0;
+  // values no register can hold, so everything is sent
+  memset(chip_period, 0xff, sizeof(chip_period));
+  memset(chip_attenuation, 0xff, sizeof(chip_attenuation));
+  chip_noise = 0xff;
+}
+
+// Set while sound_set_period() is halfway through a period.  On the
+// ColecoVision the vint is the NMI, which __critical can't hold off, so
+// sound_update() leaves the tones alone for a frame instead.
+static volatile uint8_t sound_period_busy;
+
+void sound_set_period(uint8_t ch, uint16_t period) {
+  sound_period_busy = 1;
+  sound_period[ch] = period;
+  sound_period_busy = 0;
+}
+
+void sound_set_attenuation(uint8_t ch, uint8_t attenuation) {
+  sound_attenuation[ch] = attenuation;
+}
+
+void sound_set_noise(uint8_t control) {
+  sound_noise = control;
+}
+
+#ifdef CV_MSX
+
+// no SN76489 here; libcv maps its calls onto the AY-3-8910
+void sound_update() {
+  uint8_t ch;
+  for (ch=0; ch<SOUND_VOICES && !sound_period_busy; ch++) {
+    if (sound_period[ch] != chip_period[ch]) {
+      chip_period[ch] = sound_period[ch];
+      cv_set_frequency(ch*2, chip_period[ch] << 5);
+    }
+  }
+  if (sound_noise != chip_noise) {
+    chip_noise = sound_noise;
+    cv_set_noise(chip_noise & SOUND_NOISE_WHITE, chip_noise & 3);
+  }
+  for (ch=0; ch<=SOUND_NOISE; ch++) {
+    uint8_t a = sound_attenuation[ch];
+    if (a != chip_attenuation[ch]) {
+      chip_attenuation[ch] = a;
+      // libcv takes decibels, but reads 0 as off and so never sets
+      // the loudest volume; it still does the mixer, and the noise
+      cv_set_attenuation(ch*2, a ? a*2 : 2);
+      // the tone volumes go to the AY here, 15 (loudest) down to 0
+      if (ch < SOUND_VOICES) {
+        psg_port_register = 8 + ch;
+        psg_port_write = 15 - a;
+      }
+    }
+  }
+}
+
+#else
+
+void sound_update() __naked {
+__asm
+	ld	a,(_sound_period_busy)
+	or	a
+	jr	nz,00008$		; a period is half written
+	ld	hl,#_sound_period
+	ld	de,#_chip_period
+	ld	c,#0x80			; tone latch, channel 0
+00001$:
+	ld	a,(de)
+	xor	(hl)
+	ld	b,a			; low byte changes
+	inc	hl
+	inc	de
+	ld	a,(de)
+	xor	(hl)			; high byte changes
+	jr	nz,00003$
+	or	b
+	jr	z,00004$
+	and	#0xf0
+	jr	nz,00003$
+	dec	hl			; only the low 4 bits: latch alone
+	dec	de
+	ld	a,(hl)
+	ld	(de),a
+	and	#0x0f
+	or	c
+	out	(_psg_port),a
+	inc	hl
+	inc	de
+	jr	00004$
+00003$:
+	ld	a,(hl)			; latch and data byte
+	ld	(de),a
+	ld	b,a
+	dec	hl
+	dec	de
+	ld	a,(hl)
+	ld	(de),a
+	inc	hl
+	inc	de
+	push	af
+	and	#0x0f
+	or	c
+	out	(_psg_port),a
+	pop	af
+	and	#0xf0
+	or	b
+	rrca				; period >> 4
+	rrca
+	rrca
+	rrca
+	out	(_psg_port),a
+00004$:
+	inc	hl
+	inc	de
+	ld	a,c
+	add	a,#0x20
+	ld	c,a
+	cp	#0xe0
+	jr	nz,00001$
+00008$:
+	ld	a,(_sound_noise)
+	ld	hl,#_chip_noise
+	cp	(hl)
+	jr	z,00005$
+	ld	(hl),a
+	or	#0xe0
+	out	(_psg_port),a
+00005$:
+	ld	hl,#_sound_attenuation
+	ld	de,#_chip_attenuation
+	ld	c,#0x90			; volume latch, channel 0
+00006$:
+	ld	a,(de)
+	cp	(hl)
+	jr	z,00007$
+	ld	a,(hl)
+	ld	(de),a
+	or	c
+	out	(_psg_port),a
+00007$:
+	inc	hl
+	inc	de
+	ld	a,c
+	add	a,#0x20
+	ld	c,a
+	jr	nc,00006$		; until past channel 3
+	ret
+__endasm;
+}
+
+#endif
@@ -0,0 +1,39 @@
+
+#ifndef _CV_SOUND_H
+#define _CV_SOUND_H
+
+#include <stdint.h>
+
+/*
+Shadowed SN76489 registers.  The sound_set_* functions only record
+what each channel should play; sound_update(), called once per frame
+from the vint handler, sends latch/data bytes for the registers that
+changed since the last update and nothing else.  So a player can set
+every voice every frame and the chip sees at most one write per
+changed volume and one or two per changed tone.
+*/
+
+#define SOUND_VOICES	3	// tone channels, the noise channel is 3
+#define SOUND_NOISE	3
+#define SOUND_OFF	15	// attenuation for silence
+
+// noise control bits for sound_set_noise(), with a CV_NOISE_SHIFT_*
+#define SOUND_NOISE_WHITE	4
+
+// what the next sound_update() will send (outside the vint handler,
+// set periods with sound_set_period() so it can't see half of one)
+extern uint16_t sound_period[SOUND_VOICES];	// 0-1023, clock/32/period Hz
+extern uint8_t sound_attenuation[SOUND_VOICES+1]; // 2 dB steps, 15 = off
+extern uint8_t sound_noise;
+
+// silence all channels and resend every register on the next update
+extern void sound_init();
+
+extern void sound_set_period(uint8_t ch, uint16_t period);
+extern void sound_set_attenuation(uint8_t ch, uint8_t attenuation);
+extern void sound_set_noise(uint8_t control);
+
+// write the changed registers to the chip
+extern void sound_update();
+
+#endif
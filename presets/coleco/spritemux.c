@@ -0,0 +1,239 @@
+
+#include <cv.h>
+#include <cvu.h>
+
+#include "common.h"
+#include "vramqueue.h"
+
+#include "spritemux.h"
+
+#pragma opt_code_speed
+
+uint16_t spritemux_overflows;
+
+static cv_vmemp sm_sat_addr;
+static const struct cvu_sprite* sm_sprites;
+static uint8_t sm_count;
+
+// the game's sprites in Y order as (Y + 32, sprite) pairs, kept from
+// frame to frame so the sort usually has almost nothing to do; the
+// first pair is a sentinel with key 0
+static uint8_t sm_sorted[2*(SPRITEMUX_MAX+1)];
+// the sprite that goes first in the table
+static uint8_t sm_first;
+// the attribute table, with room for the 0xd0 end marker
+static struct cvu_sprite sm_sat[SPRITEMUX_MAX+1];
+// which sprite is in each slot of the last two tables, how many
+// there were, and the vint_counter when they were queued (the VDP
+// status read in a vint is about a table queued at least two vints
+// before: one vint to send it, one to show it)
+static uint8_t sm_owner[2][SPRITEMUX_MAX];
+static uint8_t sm_shown[2];
+static uint8_t sm_queued[2];
+static uint8_t sm_table;
+
+void spritemux_init(cv_vmemp sat, const struct cvu_sprite* sprites, uint8_t count) {
+  uint8_t i;
+  if (count > SPRITEMUX_MAX)
+    count = SPRITEMUX_MAX;
+  sm_sat_addr = sat;
+  sm_sprites = sprites;
+  sm_count = count;
+  sm_sorted[0] = 0;
+  for (i=0; i<count; i++)
+    sm_sorted[i*2+3] = i;
+  sm_shown[0] = sm_shown[1] = 0;
+  sm_queued[0] = sm_queued[1] = 0;
+  sm_first = 0;
+  sm_table = 0;
+  spritemux_overflows = 0;
+}
+
+// The sort key is Y from the top of the screen, counting the lines
+// above it (Y 224-255) as negative, so the sprites below the screen
+// (Y 192-223, keys 0xe0-0xff) sort to the end.
+static void sm_sort() __naked {
+__asm
+	ld	a,(_sm_count)
+	or	a
+	ret	z
+	ld	b,a
+	ld	de,(_sm_sprites)
+	ld	hl,#(_sm_sorted+2)
+00001$:
+	inc	hl			; key = sprites[s].y + 32
+	ld	a,(hl)
+	dec	hl
+	push	hl
+	ld	l,a
+	ld	h,#0
+	add	hl,hl
+	add	hl,hl
+	add	hl,de
+	ld	a,(hl)
+	pop	hl
+	add	a,#32
+	ld	(hl),a
+	inc	hl
+	inc	hl
+	djnz	00001$
+	ld	a,(_sm_count)		; insertion sort
+	dec	a
+	ret	z
+	ld	b,a
+	ld	hl,#(_sm_sorted+4)
+00002$:
+	push	bc
+	ld	c,(hl)			; c = key
+	inc	hl
+	ld	b,(hl)			; b = sprite
+	push	hl
+	ld	e,l			; de = top of the hole
+	ld	d,h
+	dec	hl
+	dec	hl
+00003$:
+	dec	hl			; the key below
+	ld	a,c
+	cp	(hl)
+	jr	nc,00004$
+	inc	hl			; move that pair up
+	ld	a,(hl)
+	ld	(de),a
+	dec	de
+	dec	hl
+	ld	a,(hl)
+	ld	(de),a
+	dec	de
+	dec	hl
+	jr	00003$
+00004$:
+	ex	de,hl
+	ld	(hl),b
+	dec	hl
+	ld	(hl),c
+	pop	hl
+	inc	hl
+	pop	bc
+	djnz	00002$
+	ret
+__endasm;
+}
+
+// Fill sm_sat and the owners with the sprites on the screen, from
+// sm_first round to the one before it; returns how many there are.
+static uint8_t sm_build() __naked {
+__asm
+	ld	iy,#_sm_owner
+	ld	a,(_sm_table)
+	or	a
+	jr	z,00001$
+	ld	iy,#(_sm_owner+SPRITEMUX_MAX)
+00001$:
+	ld	c,#0			; c = how many
+	ld	a,(_sm_count)
+	or	a
+	jr	z,00005$
+	ld	b,a
+	ld	a,(_sm_first)
+	ld	e,a
+	ld	d,#0			; d = where it is
+	ld	hl,#(_sm_sorted+2)
+00002$:
+	ld	a,(hl)
+	cp	#0xe0
+	jr	nc,00004$		; the rest are below the screen
+	inc	hl
+	ld	a,(hl)
+	inc	hl
+	cp	e
+	jr	nz,00003$
+	ld	d,c
+00003$:
+	inc	c
+	djnz	00002$
+00004$:
+	ld	a,c
+	or	a
+	jr	z,00005$
+	push	bc
+	ld	a,d
+	push	af
+	ld	l,a
+	ld	h,#0
+	add	hl,hl
+	ld	de,#(_sm_sorted+3)
+	add	hl,de
+	ld	de,#_sm_sat
+	sub	c			; from the first to the end
+	neg
+	ld	b,a
+	call	00010$
+	pop	af
+	or	a
+	jr	z,00006$
+	ld	b,a			; then round from the top
+	ld	hl,#(_sm_sorted+3)
+	call	00010$
+00006$:
+	pop	bc
+	jr	00007$
+00005$:
+	ld	de,#_sm_sat
+00007$:
+	ld	a,#SPRITEMUX_OFF	; the end marker
+	ld	(de),a
+	ld	l,c
+	ret
+00010$:
+	ld	a,(hl)			; b sprites from hl to de
+	inc	hl
+	inc	hl
+	ld	0 (iy),a
+	inc	iy
+	push	hl
+	push	bc
+	ld	l,a
+	ld	h,#0
+	add	hl,hl
+	add	hl,hl
+	ld	bc,(_sm_sprites)
+	add	hl,bc
+	ldi
+	ldi
+	ldi
+	ldi
+	pop	bc
+	pop	hl
+	djnz	00010$
+	ret
+__endasm;
+}
+
+void spritemux_update() {
+  uint8_t now = vint_counter;
+  uint8_t slot, n, t;
+  // The dropped sprite goes first from now on.  The status is about
+  // the frame that just ended, which showed the newest table queued
+  // two or more vints ago; if neither table is that old, or a vint
+  // came in while reading it, it's not about either of them.
+  if (cv_get_sprite_invalid(&slot)) {
+    spritemux_overflows++;
+    t = sm_table ^ 1;
+    if ((uint8_t)(now - sm_queued[t]) < 2)
+      t ^= 1;
+    if ((uint8_t)(now - sm_queued[t]) >= 2 && now == vint_counter &&
+        slot < sm_shown[t])
+      sm_first = sm_owner[t][slot];
+  }
+  // a second update in the same vint replaces the first, which will
+  // never be shown, and leaves the older table alone
+  if (sm_queued[sm_table ^ 1] == now)
+    sm_table ^= 1;
+  sm_sort();
+  n = sm_build();
+  sm_shown[sm_table] = n;
+  sm_queued[sm_table] = vint_counter;
+  vq_memtovmemcpy(sm_sat_addr, sm_sat, n < SPRITEMUX_MAX ? n*4+1 : n*4);
+  sm_table ^= 1;
+}
@@ -0,0 +1,42 @@
+
+#ifndef _CV_SPRITEMUX_H
+#define _CV_SPRITEMUX_H
+
+#include <stdint.h>
+#include <cv.h>
+#include <cvu.h>
+
+/*
+Sprite multiplexer for the TMS9918's four sprites per line.  The game
+keeps its sprites in its own array of struct cvu_sprite, in whatever
+order it likes, and calls spritemux_update() once a frame.  That sorts
+them by Y into a RAM copy of the sprite attribute table and queues the
+whole table as one copy with vramqueue.h.
+
+When the VDP reports a fifth sprite on a line, the sprite it dropped
+goes first in the next table and the rest follow in Y order, wrapping
+around.  Over the next frames every sprite on a crowded line takes a
+turn being dropped, so they flicker instead of one vanishing.  With
+no fifth sprite the order stays put and nothing flickers.
+
+The table is read when the queue is flushed, so call
+spritemux_update() after the flush.  Once per frame is best, but
+updates can skip frames or come twice in one: each table is tagged
+with vint_counter (common.c), so the fifth sprite is looked up in the
+table that was on the screen.
+*/
+
+#define SPRITEMUX_MAX	32	// sprites in the attribute table
+#define SPRITEMUX_OFF	0xd0	// a Y that hides a sprite (as do 192-223)
+
+// frames that had a fifth sprite on a line
+extern uint16_t spritemux_overflows;
+
+// the attribute table at sat takes count sprites from sprites[]
+// (at most SPRITEMUX_MAX; any more are left out)
+extern void spritemux_init(cv_vmemp sat, const struct cvu_sprite* sprites, uint8_t count);
+
+// sort the sprites and queue the attribute table
+extern void spritemux_update();
+
+#endif
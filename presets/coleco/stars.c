@@ -1,23 +1,22 @@
 
 /*
-This is a demo of an animated starfield.
+This is a demo of an animated parallax starfield.
 The TMS9918 has no scrolling registers, so scrolling
 requires rewriting the pattern table on each frame.
 
-There is actually only one star in the pattern table,
-just a single pixel. We move it vertically between 16
-different character tiles (8 * 16 = 128 pixels high).
-We then draw vertical stripes of 8 repeating consecutive
-characters into the image table.
+Each layer of stars is 16 character tiles (8 * 16 = 128
+pixels high) holding a few single-pixel stars. Every
+vertical column of the screen shows one layer, as a stripe
+of the layer's 16 characters starting at a random one,
+so the stars look scattered. The far layers move slower
+and are darker than the near ones.
 
-By randomly offsetting where we begin each stripe, we
-create what appears to be a random starfield.
-(If you look closely, you'll see there's exactly two
-stars for every 8-pixel-wide vertical column.)
-
-This demo uses an interrupt handler to increment a
-counter 60 times per second. We use this counter to
-determine the new position of the star pixel when we animate.
+Moving a layer only changes a few bytes of its patterns.
+tools/mkstars.py works out, for every step of every layer,
+which runs of bytes change and what they change to, so
+starfield_update() just queues those runs as VRAM copies
+(see vramqueue.h). That is a fixed handful of VDP writes
+per frame, however many stars there are.
 */
 
 #include <cv.h>
@@ -26,61 +25,371 @@ determine the new position of the star pixel when we animate.
 //#link "common.c"
 #include "common.h"
 
+//#link "vramqueue.c"
+#include "vramqueue.h"
+
+#include "stars.h"
+
+struct star_layer {
+  const byte* init;	// runs that draw the stars at position 0
+  const byte* steps;	// runs for each step, then 0xff
+  byte frames;		// frames per step
+  byte color;
+};
+
+// runs: count, then (offset in layer, length, bytes...) for each
+// python3 tools/mkstars.py
+#define STARFIELD_LAYERS 3
+
+const byte star_columns[32] = {
+  3,16,29,32,46,23,35,16,0,32,22,16,39,31,39,23,
+  39,25,13,35,9,10,45,38,25,47,44,33,23,44,21,27,
+};
+const byte star_init_0[7] = {
+  2,8,1,64,80,1,64,
+};
+const byte star_steps_0[1157] = {
+  2,8,2,0,64,80,2,0,64,2,9,2,0,64,81,2,
+  0,64,2,10,2,0,64,82,2,0,64,2,11,2,0,64,
+  83,2,0,64,2,12,2,0,64,84,2,0,64,2,13,2,
+  0,64,85,2,0,64,2,14,2,0,64,86,2,0,64,2,
+  15,2,0,64,87,2,0,64,2,16,2,0,64,88,2,0,
+  64,2,17,2,0,64,89,2,0,64,2,18,2,0,64,90,
+  2,0,64,2,19,2,0,64,91,2,0,64,2,20,2,0,
+  64,92,2,0,64,2,21,2,0,64,93,2,0,64,2,22,
+  2,0,64,94,2,0,64,2,23,2,0,64,95,2,0,64,
+  2,24,2,0,64,96,2,0,64,2,25,2,0,64,97,2,
+  0,64,2,26,2,0,64,98,2,0,64,2,27,2,0,64,
+  99,2,0,64,2,28,2,0,64,100,2,0,64,2,29,2,
+  0,64,101,2,0,64,2,30,2,0,64,102,2,0,64,2,
+  31,2,0,64,103,2,0,64,2,32,2,0,64,104,2,0,
+  64,2,33,2,0,64,105,2,0,64,2,34,2,0,64,106,
+  2,0,64,2,35,2,0,64,107,2,0,64,2,36,2,0,
+  64,108,2,0,64,2,37,2,0,64,109,2,0,64,2,38,
+  2,0,64,110,2,0,64,2,39,2,0,64,111,2,0,64,
+  2,40,2,0,64,112,2,0,64,2,41,2,0,64,113,2,
+  0,64,2,42,2,0,64,114,2,0,64,2,43,2,0,64,
+  115,2,0,64,2,44,2,0,64,116,2,0,64,2,45,2,
+  0,64,117,2,0,64,2,46,2,0,64,118,2,0,64,2,
+  47,2,0,64,119,2,0,64,2,48,2,0,64,120,2,0,
+  64,2,49,2,0,64,121,2,0,64,2,50,2,0,64,122,
+  2,0,64,2,51,2,0,64,123,2,0,64,2,52,2,0,
+  64,124,2,0,64,2,53,2,0,64,125,2,0,64,2,54,
+  2,0,64,126,2,0,64,3,0,1,64,55,2,0,64,127,
+  1,0,2,0,2,0,64,56,2,0,64,2,1,2,0,64,
+  57,2,0,64,2,2,2,0,64,58,2,0,64,2,3,2,
+  0,64,59,2,0,64,2,4,2,0,64,60,2,0,64,2,
+  5,2,0,64,61,2,0,64,2,6,2,0,64,62,2,0,
+  64,2,7,2,0,64,63,2,0,64,2,8,2,0,64,64,
+  2,0,64,2,9,2,0,64,65,2,0,64,2,10,2,0,
+  64,66,2,0,64,2,11,2,0,64,67,2,0,64,2,12,
+  2,0,64,68,2,0,64,2,13,2,0,64,69,2,0,64,
+  2,14,2,0,64,70,2,0,64,2,15,2,0,64,71,2,
+  0,64,2,16,2,0,64,72,2,0,64,2,17,2,0,64,
+  73,2,0,64,2,18,2,0,64,74,2,0,64,2,19,2,
+  0,64,75,2,0,64,2,20,2,0,64,76,2,0,64,2,
+  21,2,0,64,77,2,0,64,2,22,2,0,64,78,2,0,
+  64,2,23,2,0,64,79,2,0,64,2,24,2,0,64,80,
+  2,0,64,2,25,2,0,64,81,2,0,64,2,26,2,0,
+  64,82,2,0,64,2,27,2,0,64,83,2,0,64,2,28,
+  2,0,64,84,2,0,64,2,29,2,0,64,85,2,0,64,
+  2,30,2,0,64,86,2,0,64,2,31,2,0,64,87,2,
+  0,64,2,32,2,0,64,88,2,0,64,2,33,2,0,64,
+  89,2,0,64,2,34,2,0,64,90,2,0,64,2,35,2,
+  0,64,91,2,0,64,2,36,2,0,64,92,2,0,64,2,
+  37,2,0,64,93,2,0,64,2,38,2,0,64,94,2,0,
+  64,2,39,2,0,64,95,2,0,64,2,40,2,0,64,96,
+  2,0,64,2,41,2,0,64,97,2,0,64,2,42,2,0,
+  64,98,2,0,64,2,43,2,0,64,99,2,0,64,2,44,
+  2,0,64,100,2,0,64,2,45,2,0,64,101,2,0,64,
+  2,46,2,0,64,102,2,0,64,2,47,2,0,64,103,2,
+  0,64,2,48,2,0,64,104,2,0,64,2,49,2,0,64,
+  105,2,0,64,2,50,2,0,64,106,2,0,64,2,51,2,
+  0,64,107,2,0,64,2,52,2,0,64,108,2,0,64,2,
+  53,2,0,64,109,2,0,64,2,54,2,0,64,110,2,0,
+  64,2,55,2,0,64,111,2,0,64,2,56,2,0,64,112,
+  2,0,64,2,57,2,0,64,113,2,0,64,2,58,2,0,
+  64,114,2,0,64,2,59,2,0,64,115,2,0,64,2,60,
+  2,0,64,116,2,0,64,2,61,2,0,64,117,2,0,64,
+  2,62,2,0,64,118,2,0,64,2,63,2,0,64,119,2,
+  0,64,2,64,2,0,64,120,2,0,64,2,65,2,0,64,
+  121,2,0,64,2,66,2,0,64,122,2,0,64,2,67,2,
+  0,64,123,2,0,64,2,68,2,0,64,124,2,0,64,2,
+  69,2,0,64,125,2,0,64,2,70,2,0,64,126,2,0,
+  64,3,0,1,64,71,2,0,64,127,1,0,2,0,2,0,
+  64,72,2,0,64,2,1,2,0,64,73,2,0,64,2,2,
+  2,0,64,74,2,0,64,2,3,2,0,64,75,2,0,64,
+  2,4,2,0,64,76,2,0,64,2,5,2,0,64,77,2,
+  0,64,2,6,2,0,64,78,2,0,64,2,7,2,0,64,
+  79,2,0,64,255,
+};
+const byte star_init_1[4] = {
+  1,63,1,1,
+};
+const byte star_steps_1[643] = {
+  1,63,2,0,1,1,64,2,0,1,1,65,2,0,1,1,
+  66,2,0,1,1,67,2,0,1,1,68,2,0,1,1,69,
+  2,0,1,1,70,2,0,1,1,71,2,0,1,1,72,2,
+  0,1,1,73,2,0,1,1,74,2,0,1,1,75,2,0,
+  1,1,76,2,0,1,1,77,2,0,1,1,78,2,0,1,
+  1,79,2,0,1,1,80,2,0,1,1,81,2,0,1,1,
+  82,2,0,1,1,83,2,0,1,1,84,2,0,1,1,85,
+  2,0,1,1,86,2,0,1,1,87,2,0,1,1,88,2,
+  0,1,1,89,2,0,1,1,90,2,0,1,1,91,2,0,
+  1,1,92,2,0,1,1,93,2,0,1,1,94,2,0,1,
+  1,95,2,0,1,1,96,2,0,1,1,97,2,0,1,1,
+  98,2,0,1,1,99,2,0,1,1,100,2,0,1,1,101,
+  2,0,1,1,102,2,0,1,1,103,2,0,1,1,104,2,
+  0,1,1,105,2,0,1,1,106,2,0,1,1,107,2,0,
+  1,1,108,2,0,1,1,109,2,0,1,1,110,2,0,1,
+  1,111,2,0,1,1,112,2,0,1,1,113,2,0,1,1,
+  114,2,0,1,1,115,2,0,1,1,116,2,0,1,1,117,
+  2,0,1,1,118,2,0,1,1,119,2,0,1,1,120,2,
+  0,1,1,121,2,0,1,1,122,2,0,1,1,123,2,0,
+  1,1,124,2,0,1,1,125,2,0,1,1,126,2,0,1,
+  2,0,1,1,127,1,0,1,0,2,0,1,1,1,2,0,
+  1,1,2,2,0,1,1,3,2,0,1,1,4,2,0,1,
+  1,5,2,0,1,1,6,2,0,1,1,7,2,0,1,1,
+  8,2,0,1,1,9,2,0,1,1,10,2,0,1,1,11,
+  2,0,1,1,12,2,0,1,1,13,2,0,1,1,14,2,
+  0,1,1,15,2,0,1,1,16,2,0,1,1,17,2,0,
+  1,1,18,2,0,1,1,19,2,0,1,1,20,2,0,1,
+  1,21,2,0,1,1,22,2,0,1,1,23,2,0,1,1,
+  24,2,0,1,1,25,2,0,1,1,26,2,0,1,1,27,
+  2,0,1,1,28,2,0,1,1,29,2,0,1,1,30,2,
+  0,1,1,31,2,0,1,1,32,2,0,1,1,33,2,0,
+  1,1,34,2,0,1,1,35,2,0,1,1,36,2,0,1,
+  1,37,2,0,1,1,38,2,0,1,1,39,2,0,1,1,
+  40,2,0,1,1,41,2,0,1,1,42,2,0,1,1,43,
+  2,0,1,1,44,2,0,1,1,45,2,0,1,1,46,2,
+  0,1,1,47,2,0,1,1,48,2,0,1,1,49,2,0,
+  1,1,50,2,0,1,1,51,2,0,1,1,52,2,0,1,
+  1,53,2,0,1,1,54,2,0,1,1,55,2,0,1,1,
+  56,2,0,1,1,57,2,0,1,1,58,2,0,1,1,59,
+  2,0,1,1,60,2,0,1,1,61,2,0,1,1,62,2,
+  0,1,255,
+};
+const byte star_init_2[4] = {
+  1,60,1,2,
+};
+const byte star_steps_2[643] = {
+  1,60,2,0,2,1,61,2,0,2,1,62,2,0,2,1,
+  63,2,0,2,1,64,2,0,2,1,65,2,0,2,1,66,
+  2,0,2,1,67,2,0,2,1,68,2,0,2,1,69,2,
+  0,2,1,70,2,0,2,1,71,2,0,2,1,72,2,0,
+  2,1,73,2,0,2,1,74,2,0,2,1,75,2,0,2,
+  1,76,2,0,2,1,77,2,0,2,1,78,2,0,2,1,
+  79,2,0,2,1,80,2,0,2,1,81,2,0,2,1,82,
+  2,0,2,1,83,2,0,2,1,84,2,0,2,1,85,2,
+  0,2,1,86,2,0,2,1,87,2,0,2,1,88,2,0,
+  2,1,89,2,0,2,1,90,2,0,2,1,91,2,0,2,
+  1,92,2,0,2,1,93,2,0,2,1,94,2,0,2,1,
+  95,2,0,2,1,96,2,0,2,1,97,2,0,2,1,98,
+  2,0,2,1,99,2,0,2,1,100,2,0,2,1,101,2,
+  0,2,1,102,2,0,2,1,103,2,0,2,1,104,2,0,
+  2,1,105,2,0,2,1,106,2,0,2,1,107,2,0,2,
+  1,108,2,0,2,1,109,2,0,2,1,110,2,0,2,1,
+  111,2,0,2,1,112,2,0,2,1,113,2,0,2,1,114,
+  2,0,2,1,115,2,0,2,1,116,2,0,2,1,117,2,
+  0,2,1,118,2,0,2,1,119,2,0,2,1,120,2,0,
+  2,1,121,2,0,2,1,122,2,0,2,1,123,2,0,2,
+  1,124,2,0,2,1,125,2,0,2,1,126,2,0,2,2,
+  0,1,2,127,1,0,1,0,2,0,2,1,1,2,0,2,
+  1,2,2,0,2,1,3,2,0,2,1,4,2,0,2,1,
+  5,2,0,2,1,6,2,0,2,1,7,2,0,2,1,8,
+  2,0,2,1,9,2,0,2,1,10,2,0,2,1,11,2,
+  0,2,1,12,2,0,2,1,13,2,0,2,1,14,2,0,
+  2,1,15,2,0,2,1,16,2,0,2,1,17,2,0,2,
+  1,18,2,0,2,1,19,2,0,2,1,20,2,0,2,1,
+  21,2,0,2,1,22,2,0,2,1,23,2,0,2,1,24,
+  2,0,2,1,25,2,0,2,1,26,2,0,2,1,27,2,
+  0,2,1,28,2,0,2,1,29,2,0,2,1,30,2,0,
+  2,1,31,2,0,2,1,32,2,0,2,1,33,2,0,2,
+  1,34,2,0,2,1,35,2,0,2,1,36,2,0,2,1,
+  37,2,0,2,1,38,2,0,2,1,39,2,0,2,1,40,
+  2,0,2,1,41,2,0,2,1,42,2,0,2,1,43,2,
+  0,2,1,44,2,0,2,1,45,2,0,2,1,46,2,0,
+  2,1,47,2,0,2,1,48,2,0,2,1,49,2,0,2,
+  1,50,2,0,2,1,51,2,0,2,1,52,2,0,2,1,
+  53,2,0,2,1,54,2,0,2,1,55,2,0,2,1,56,
+  2,0,2,1,57,2,0,2,1,58,2,0,2,1,59,2,
+  0,2,255,
+};
+const struct star_layer star_layers[STARFIELD_LAYERS] = {
+  { star_init_0, star_steps_0, 4, 4 },
+  { star_init_1, star_steps_1, 2, 14 },
+  { star_init_2, star_steps_2, 1, 15 },
+};
+// at most 3 runs per layer step
+
 // the starting character index in the pattern table
-char starfield_base_char = 240;
-
-// a random offset for every vertical column
-const char star_yoffsets[32] = {
-  31, 11, 25, 10, 21, 1, 9, 6,
-  22, 3, 7, 14, 15, 18, 0, 29,
-  30, 5, 16, 28, 20, 12, 24, 17,
-  13, 8, 26, 19, 23, 27, 2, 4
+byte starfield_base_char = 256 - STARFIELD_LAYERS*16;
+
+// where each layer is in its steps
+struct star_state {
+  const byte* next;	// the next step
+  word addr;		// the layer's patterns in VRAM
+  byte wait;		// frames since the last step
 };
 
+static struct star_state star_state[STARFIELD_LAYERS];
+static byte star_oldcounter;
+
 // returns the tile index for every (x,y) position
 byte starfield_get_tile_xy(byte x, byte y) {
-  return ((star_yoffsets[x] + y) & 15) + starfield_base_char;
+  byte c = star_columns[x];
+  return ((c + y) & 15) + (c & 0xf0) + starfield_base_char;
 }
 
 // set up starfield image and pattern table
 void starfield_setup() {
+  byte x, y, l;
+  word addr = PATTERN + starfield_base_char * 8;
   // clear star patterns
-  cvu_vmemset(PATTERN+starfield_base_char*8, 0, 16*8);
+  cvu_vmemset(addr, 0, STARFIELD_LAYERS*128);
+  for (l=0; l<STARFIELD_LAYERS; l++) {
+    const struct star_layer* layer = &star_layers[l];
+    const byte* p = layer->init;
+    byte n = *p++;
+    // draw the stars
+    while (n--) {
+      byte len = p[1];
+      cvu_memtovmemcpy(addr + p[0], p + 2, len);
+      p += len + 2;
+    }
+    // set value in color table for the layer's two groups of 8
+    cvu_vmemset(COLOR + ((starfield_base_char + l*16) >> 3),
+                COLOR_FG(layer->color), 2);
+    star_state[l].next = layer->steps;
+    star_state[l].addr = addr;
+    star_state[l].wait = 0;
+    addr += 128;
+  }
   // write starfield image table
-  for (byte x=0; x<32; x++) {
-    for (byte y=0; y<28; y++) {
+  for (x=0; x<COLS; x++) {
+    for (y=0; y<ROWS; y++) {
       putcharxy(x, y, starfield_get_tile_xy(x, y));
     }
-    // set value in color table for each character
-    cvu_voutb(COLOR_FG(CV_COLOR_WHITE),
-              COLOR+((starfield_base_char+x)>>3));
   }
+  star_oldcounter = vint_counter;
 }
 
 // call each frame to animate starfield
-void starfield_update() {
-  static byte oldcounter;
-  const byte mask = 0x7f; // 128 star bytes
-  // interrupt counter increments every frame
-  // use this value to determine new star position
-  byte counter = vint_counter;
-  // base address in pattern table
-  word base = PATTERN + starfield_base_char * 8;
-  // erase old star, create new star in pattern table
-  cvu_voutb(0, base + (oldcounter & mask));
-  cvu_voutb(8, base + (counter & mask));
-  // make sure we remember counter value to erase
-  // in case we skip a frame
-  oldcounter = counter;
+// (this runs every frame, so it's written in assembly)
+void starfield_update() __naked {
+__asm
+	; interrupt counter increments every frame
+	; use it to see how many frames have passed
+	ld	a,(_vint_counter)
+	ld	hl,#_star_oldcounter
+	ld	c,a
+	sub	(hl)
+	ld	(hl),c
+	ld	c,a			; c = frames elapsed
+	ld	iy,#_star_state
+	ld	hl,#_star_layers+4	; frames per step
+	ld	b,#STARFIELD_LAYERS
+00001$:
+	ld	a,4 (iy)		; wait
+	add	a,c
+	jr	nc,00002$
+	ld	a,#0xff
+00002$:
+	sub	(hl)
+	jr	c,00004$
+	; at most one step per call, so the queue stays small
+	; if we skip frames the layer just slows down
+	cp	(hl)
+	jr	c,00003$
+	xor	a
+00003$:
+	ld	4 (iy),a
+	push	bc
+	push	hl
+	dec	hl
+	ld	d,(hl)
+	dec	hl
+	ld	e,(hl)			; de = first step
+	call	00010$
+	pop	hl
+	pop	bc
+	jr	00005$
+00004$:
+	add	a,(hl)
+	ld	4 (iy),a
+00005$:
+	ld	de,#5			; sizeof(struct star_state)
+	add	iy,de
+	ld	de,#6			; sizeof(struct star_layer)
+	add	hl,de
+	djnz	00001$
+	ret
+
+	; queue the runs of the next step of the layer at iy
+00010$:
+	ld	l,0 (iy)		; next
+	ld	h,1 (iy)
+	ld	a,(hl)			; number of runs
+	inc	hl
+	inc	a
+	jr	nz,00011$
+	ex	de,hl			; 0xff: back to the first step
+	ld	a,(hl)
+	inc	hl
+	inc	a
+00011$:
+	dec	a
+	jr	z,00013$
+	ld	b,a
+00012$:
+	push	bc
+	ld	e,(hl)			; offset
+	inc	hl
+	ld	c,(hl)			; length
+	ld	b,#0
+	inc	hl
+	push	hl
+	push	bc
+	push	iy
+	push	bc			; vq_memtovmemcpy(addr + offset, hl, length)
+	push	hl
+	ld	a,2 (iy)
+	add	a,e
+	ld	e,a
+	ld	a,3 (iy)
+	adc	a,#0
+	ld	d,a
+	push	de
+	call	_vq_memtovmemcpy
+	pop	af
+	pop	af
+	pop	af
+	pop	iy
+	pop	bc
+	pop	hl
+	add	hl,bc			; past the bytes
+	pop	bc
+	djnz	00012$
+00013$:
+	ld	0 (iy),l
+	ld	1 (iy),h
+	ret
+__endasm;
 }
 
 #ifdef __MAIN__
 
+void starfield_vint_handler() {
+  vint_counter++;
+  vq_flush();
+}
+
 void main() {
   vdp_setup();
-  // set up default interrupt handler
-  cv_set_vint_handler(&vint_handler);
+  vq_init();
   starfield_setup();
+  // set up interrupt handler that writes the queued updates
+  cv_set_vint_handler(&starfield_vint_handler);
   cv_set_screen_active(true);
   while(1) {
     wait_vsync();
@@ -1,6 +1,12 @@
 
+/*
+Parallax starfield in the last characters of the pattern table,
+16 per layer (48 for the three layers in stars.c).  starfield_update() queues
+its pattern writes with vramqueue.h, so the vint handler (or the
+main loop, right after the vsync) has to call vq_flush().
+*/
+
 extern unsigned char starfield_base_char;
 extern unsigned char starfield_get_tile_xy(unsigned char x, unsigned char y);
 extern void starfield_setup();
 extern void starfield_update();
-
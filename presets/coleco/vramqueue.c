@@ -0,0 +1,340 @@
+
+#include <cv.h>
+
+#include "vramqueue.h"
+
+#pragma opt_code_speed
+
+#ifdef CV_MSX
+#define VDP_DATA	0x98
+#define VDP_CONTROL	0x99
+#else
+#define VDP_DATA	0xbe
+#define VDP_CONTROL	0xbf
+#endif
+
+__sfr __at (VDP_DATA) vdp_data;
+__sfr __at (VDP_CONTROL) vdp_control;
+
+// entries: op, VRAM address, then
+//   VQ_BYTE	value
+//   VQ_FILL	value, count (0 = 256)
+//   VQ_COPY	source address, count (0 = 256)
+// VQ_WRAP sends the reader back to the start of the buffer.
+#define VQ_WRAP	0
+#define VQ_BYTE	1
+#define VQ_FILL	2
+#define VQ_COPY	3
+
+static uint8_t vq_buffer[VQ_SIZE];
+// only the game moves vq_head and only vq_flush() moves vq_tail
+static volatile uint8_t vq_head;
+static volatile uint8_t vq_tail;
+
+uint16_t vq_frame_bytes;
+uint16_t vq_max_frame_bytes;
+uint16_t vq_full_count;
+
+void vq_init() {
+  vq_head = vq_tail = 0;
+  vq_frame_bytes = vq_max_frame_bytes = vq_full_count = 0;
+}
+
+// Room for an entry of c bytes that doesn't wrap: returns hl pointing
+// at it, or carry set if the write is dropped.  Keeps c, de and ix.
+static void vq_reserve() __naked {
+__asm
+	call	00010$
+	ret	nc
+	ld	hl,(_vq_full_count)
+	inc	hl
+	ld	(_vq_full_count),hl
+#ifdef VQ_DROP_WHEN_FULL
+	scf
+	ret
+#else
+00001$:
+	call	00010$			; wait for vq_flush()
+	jr	c,00001$
+	ret
+#endif
+00010$:
+	ld	a,(_vq_tail)
+	ld	b,a
+	ld	a,(_vq_head)
+	ld	l,a
+	cp	b
+	jr	c,00012$
+	ld	a,#(VQ_SIZE-1)		; keep a byte for the wrap marker
+	sub	l
+	cp	c
+	jr	nc,00013$
+	ld	a,c			; no room before the end: at the start?
+	cp	b
+	ccf
+	ret	c
+	call	00013$
+	ld	(hl),#VQ_WRAP
+	ld	hl,#_vq_buffer
+	ret
+00012$:
+	ld	a,b			; head < tail
+	sub	l
+	dec	a
+	cp	c
+	ret	c
+00013$:
+	ld	a,l			; hl = &vq_buffer[l], carry clear
+	add	a,#<(_vq_buffer)
+	ld	l,a
+	ld	a,#>(_vq_buffer)
+	adc	a,#0
+	ld	h,a
+	or	a
+	ret
+__endasm;
+}
+
+// The entry ends at hl: let the vint handler see it.
+static void vq_commit() __naked {
+__asm
+	ld	a,l
+	sub	#<(_vq_buffer)
+	ld	(_vq_head),a
+	ret
+__endasm;
+}
+
+void vq_voutb(uint8_t value, cv_vmemp dest) __naked {
+  value; dest; // to avoid warning
+__asm
+	push	ix
+	ld	ix,#0
+	add	ix,sp
+	ld	c,#4
+	call	_vq_reserve
+	jr	c,00001$
+	ld	(hl),#VQ_BYTE
+	inc	hl
+	ld	a,5 (ix)		; dest
+	ld	(hl),a
+	inc	hl
+	ld	a,6 (ix)
+	ld	(hl),a
+	inc	hl
+	ld	a,4 (ix)		; value
+	ld	(hl),a
+	inc	hl
+	call	_vq_commit
+00001$:
+	pop	ix
+	ret
+__endasm;
+}
+
+// Fills and copies go in entries of up to 256 bytes (count 0 = 256);
+// dest, source and count in the argument slots move on after each.
+
+void vq_vmemset(cv_vmemp dest, uint8_t value, uint16_t count) __naked {
+  dest; value; count; // to avoid warning
+__asm
+	push	ix
+	ld	ix,#0
+	add	ix,sp
+00001$:
+	ld	a,8 (ix)		; count
+	or	7 (ix)
+	jr	z,00004$
+	ld	c,#5
+	call	_vq_reserve
+	jr	c,00004$
+	ld	(hl),#VQ_FILL
+	inc	hl
+	ld	a,4 (ix)		; dest
+	ld	(hl),a
+	inc	hl
+	ld	a,5 (ix)
+	ld	(hl),a
+	inc	hl
+	ld	a,6 (ix)		; value
+	ld	(hl),a
+	inc	hl
+	ld	a,8 (ix)
+	or	a
+	ld	a,7 (ix)
+	jr	z,00002$
+	xor	a			; 256 of them
+	dec	8 (ix)
+	inc	5 (ix)
+	jr	00003$
+00002$:
+	ld	7 (ix),#0		; the rest
+00003$:
+	ld	(hl),a
+	inc	hl
+	call	_vq_commit
+	jr	00001$
+00004$:
+	pop	ix
+	ret
+__endasm;
+}
+
+void vq_memtovmemcpy(cv_vmemp dest, const void* src, uint16_t count) __naked {
+  dest; src; count; // to avoid warning
+__asm
+	push	ix
+	ld	ix,#0
+	add	ix,sp
+00001$:
+	ld	a,9 (ix)		; count
+	or	8 (ix)
+	jr	z,00004$
+	ld	c,#6
+	call	_vq_reserve
+	jr	c,00004$
+	ld	(hl),#VQ_COPY
+	inc	hl
+	ld	a,4 (ix)		; dest
+	ld	(hl),a
+	inc	hl
+	ld	a,5 (ix)
+	ld	(hl),a
+	inc	hl
+	ld	a,6 (ix)		; src
+	ld	(hl),a
+	inc	hl
+	ld	a,7 (ix)
+	ld	(hl),a
+	inc	hl
+	ld	a,9 (ix)
+	or	a
+	ld	a,8 (ix)
+	jr	z,00002$
+	xor	a			; 256 of them
+	dec	9 (ix)
+	inc	5 (ix)
+	inc	7 (ix)
+	jr	00003$
+00002$:
+	ld	8 (ix),#0		; the rest
+00003$:
+	ld	(hl),a
+	inc	hl
+	call	_vq_commit
+	jr	00001$
+00004$:
+	pop	ix
+	ret
+__endasm;
+}
+
+void vq_wait() {
+  while (vq_head != vq_tail) ;
+}
+
+void vq_flush() __naked {
+__asm
+	ld	hl,#0
+	ld	(_vq_frame_bytes),hl
+	ld	a,(_vq_tail)
+	ld	e,a			; e = index of the entry
+	ld	d,#0
+	ld	hl,#_vq_buffer
+	add	hl,de
+00001$:
+	ld	a,(_vq_head)
+	cp	e
+	jr	z,00009$
+	ld	a,(hl)
+	or	a			; VQ_WRAP
+	jr	nz,00002$
+	ld	hl,#_vq_buffer
+	ld	e,a
+	jr	00001$
+00002$:
+	push	de
+	ld	de,#1			; count the bytes of this entry
+	dec	a
+	jr	z,00011$		; VQ_BYTE
+	push	hl
+	ld	de,#4
+	add	hl,de
+	dec	a
+	jr	z,00010$		; VQ_FILL: count at +4
+	inc	hl			; VQ_COPY: count at +5
+00010$:
+	ld	e,(hl)
+	dec	e
+	inc	de			; 0 = 256
+	pop	hl
+00011$:
+	push	hl
+	ld	hl,(_vq_frame_bytes)
+	add	hl,de
+	ex	de,hl
+	ld	hl,#VQ_FRAME_BYTES
+	or	a
+	sbc	hl,de
+	pop	hl
+	jr	nc,00012$
+	pop	de			; leave the rest for the next frame
+	jr	00009$
+00012$:
+	ld	(_vq_frame_bytes),de
+	pop	de
+	ld	b,(hl)			; op
+	inc	hl
+	ld	a,(hl)			; VRAM address
+	out	(_vdp_control),a
+	inc	hl
+	ld	a,(hl)
+	or	#0x40			; write
+	out	(_vdp_control),a
+	inc	hl
+	ld	a,(hl)			; value or source low byte
+	inc	hl
+	djnz	00003$
+	out	(_vdp_data),a		; VQ_BYTE
+	ld	a,#4
+	jr	00008$
+00003$:
+	djnz	00005$
+	ld	b,(hl)			; VQ_FILL
+	inc	hl
+00004$:
+	out	(_vdp_data),a
+	djnz	00004$
+	ld	a,#5
+	jr	00008$
+00005$:
+	push	de			; VQ_COPY
+	ld	e,a
+	ld	d,(hl)
+	inc	hl
+	ld	b,(hl)
+	inc	hl
+	push	hl
+	ex	de,hl
+	ld	c,#VDP_DATA
+	otir
+	pop	hl
+	pop	de
+	ld	a,#6
+00008$:
+	add	a,e			; a = entry size
+	ld	e,a
+	jr	00001$
+00009$:
+	ld	a,e
+	ld	(_vq_tail),a
+	ld	hl,(_vq_frame_bytes)
+	ld	de,(_vq_max_frame_bytes)
+	or	a
+	sbc	hl,de
+	ret	c
+	add	hl,de
+	ld	(_vq_max_frame_bytes),hl
+	ret
+__endasm;
+}
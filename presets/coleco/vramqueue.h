@@ -0,0 +1,70 @@
+
+#ifndef _CV_VRAMQUEUE_H
+#define _CV_VRAMQUEUE_H
+
+#include <stdint.h>
+#include <cv.h>
+
+/*
+VRAM write queue.  Game code queues its VRAM writes at any time, and
+vq_flush(), called from the vint handler, sends them to the VDP during
+vertical blank with tight OUT loops.  The game never touches the VDP
+itself, so the NMI can't break into a half-set VRAM address, and the
+writes don't have to be slowed down for the active display.
+
+Copies don't take the data along: the source is read when the vint
+handler gets to it, so it has to stay as it is until then (ROM, or a
+buffer the game leaves alone until vq_wait()).
+
+If the game also writes to the VDP itself, an NMI that flushes the
+queue would move the VRAM address under it.  Such a game can call
+vq_flush() from its main loop right after waiting for the vsync
+instead, but then it has to keep a frame's writes within VQ_SIZE, as
+nothing else will empty a full queue.  The wait has to be a real one
+(wait_vsync() halts until the NMI): a check of vint_counter can return
+in the middle of the display, where these loops write faster than the
+VDP takes the bytes.
+
+When the queue is full, the queue functions wait for the vint handler
+to make room (don't call them from the handler itself).  Define
+VQ_DROP_WHEN_FULL to drop the write instead.  Either way vq_full_count
+goes up.
+*/
+
+// bytes of queue (at most 255): 4 per vq_voutb(), 5 per fill, 6 per
+// copy of up to 256
+#ifndef VQ_SIZE
+#define VQ_SIZE 64
+#endif
+
+// vq_flush() won't start a write that would take the frame past this
+// many bytes (at least 256); the rest go out in the next frame.  The
+// default keeps the flush inside the NTSC vertical blank, 70 lines of
+// 228 T-states: a fill byte takes 24 T-states (OUT + DJNZ, OTIR is
+// 21), and a third of the blank is left for the rest of the vint
+// handler and the entries' own overhead.
+#define VQ_VBLANK_TSTATES (70*228)
+#ifndef VQ_FRAME_BYTES
+#define VQ_FRAME_BYTES (VQ_VBLANK_TSTATES*2/3/24)
+#endif
+#if VQ_FRAME_BYTES < 256
+#error "VQ_FRAME_BYTES must be at least 256"
+#endif
+
+extern uint16_t vq_frame_bytes;		// VRAM bytes written by the last flush
+extern uint16_t vq_max_frame_bytes;	// the most in any frame
+extern uint16_t vq_full_count;		// writes that found the queue full
+
+extern void vq_init();
+
+extern void vq_voutb(uint8_t value, cv_vmemp dest);
+extern void vq_vmemset(cv_vmemp dest, uint8_t value, uint16_t count);
+extern void vq_memtovmemcpy(cv_vmemp dest, const void* src, uint16_t count);
+
+// wait until everything queued has been written
+extern void vq_wait();
+
+// write the queue to VRAM; call from the vint handler (or see above)
+extern void vq_flush();
+
+#endif
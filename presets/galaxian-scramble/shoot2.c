@@ -1,6 +1,8 @@
 
 #include <string.h>
 
+#pragma opt_code_speed
+
 typedef unsigned char byte;
 typedef unsigned short word;
 typedef unsigned char sbyte;
@@ -219,20 +221,6 @@ word rand() {
 
 // GAME CODE
 
-typedef struct {
-  byte shape;
-} FormationEnemy;
-
-// should be power of 2 length
-typedef struct {
-  byte findex;
-  byte shape;
-  word x;
-  word y;
-  byte dir;
-  byte returning;
-} AttackingEnemy;
-
 typedef struct {
   signed char dx;
   byte xpos;
@@ -245,8 +233,24 @@ typedef struct {
 #define MAX_IN_FORMATION (ENEMIES_PER_ROW*ENEMY_ROWS)
 #define MAX_ATTACKERS 6
 
-FormationEnemy formation[MAX_IN_FORMATION];
-AttackingEnemy attackers[MAX_ATTACKERS];
+// the formation is one bitmask per row, bit N = column N;
+// formation_drawn is what is in video RAM right now
+byte formation_mask[ENEMY_ROWS];
+byte formation_drawn[ENEMY_ROWS];
+byte formation_shape[ENEMY_ROWS];
+
+const byte COLUMN_BIT[ENEMIES_PER_ROW] = {
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
+// attackers are kept as one array per field, indexed by slot
+byte attacker_findex[MAX_ATTACKERS]; // formation index + 1, 0 = free
+byte attacker_shape[MAX_ATTACKERS];
+word attacker_x[MAX_ATTACKERS];
+word attacker_y[MAX_ATTACKERS];
+byte attacker_dir[MAX_ATTACKERS];
+byte attacker_returning[MAX_ATTACKERS];
+
 Missile missiles[8];
 
 byte formation_offset_x;
@@ -268,36 +272,53 @@ void add_score(word bcd) {
 
 void setup_formation() {
   byte i;
-  memset(formation, 0, sizeof(formation));
-  memset(attackers, 0, sizeof(attackers));
+  memset(attacker_findex, 0, sizeof(attacker_findex));
+  memset(attacker_y, 0, sizeof(attacker_y));
   memset(missiles, 0, sizeof(missiles));
-  for (i=0; i<MAX_IN_FORMATION; i++) {
-    byte flagship = i < ENEMIES_PER_ROW;
-    formation[i].shape = flagship ? 0x43 : 0x43;
+  for (i=0; i<ENEMY_ROWS; i++) {
+    byte flagship = i == 0;
+    formation_mask[i] = 0xff;
+    formation_drawn[i] = 0; // the screen is blank
+    formation_shape[i] = flagship ? 0x43 : 0x43;
   }
   enemies_left = MAX_IN_FORMATION;
 }
 
+// redraw the columns of a row that changed since the last call
+// (the sway is done by the column scroll registers, not by tiles)
 void draw_row(byte row) {
-  byte i;
   byte y = 4 + row * 2;
-  vcolumns[y].attrib = 0x2;
-  vcolumns[y].scroll = formation_offset_x;
-  for (i=0; i<ENEMIES_PER_ROW; i++) {
-    byte x = i * 3;
-    byte shape = formation[i + row*ENEMIES_PER_ROW].shape;
-    if (shape) {
-      putchar(x, y, shape);
-      putchar(x+1, y, shape-2);
-    } else {
-      putchar(x, y, BLANK);
-      putchar(x+1, y, BLANK);
+  byte mask = formation_mask[row];
+  byte changed = mask ^ formation_drawn[row];
+  byte shape = formation_shape[row];
+  byte* dest = &vram[29][y];
+  formation_drawn[row] = mask;
+  while (changed) {
+    if (changed & 1) {
+      if (mask & 1) {
+        dest[0] = shape;
+        dest[-32] = shape-2;
+      } else {
+        dest[0] = BLANK;
+        dest[-32] = BLANK;
+      }
     }
+    changed >>= 1;
+    mask >>= 1;
+    dest -= 32*3;
   }
 }
 
+// update the tiles of every row that changed, and sway one row
 void draw_next_row() {
-  draw_row(current_row);
+  byte row;
+  byte y = 4 + current_row * 2;
+  for (row=0; row<ENEMY_ROWS; row++) {
+    if (formation_mask[row] != formation_drawn[row])
+      draw_row(row);
+  }
+  vcolumns[y].attrib = 0x2;
+  vcolumns[y].scroll = formation_offset_x;
   if (++current_row == ENEMY_ROWS) {
     current_row = 0;
     formation_offset_x += formation_direction;
@@ -351,60 +372,52 @@ byte get_attacker_y(byte formation_index) {
   return FORMATION_YSPACE*row + FORMATION_Y0;
 }
 
-void draw_attacker(byte i) {
-  AttackingEnemy* a = &attackers[i];
-  if (a->findex) {
-    byte code = DIR_TO_CODE[a->dir & 31];
-    vsprites[i].code = code + a->shape + 14;
-    vsprites[i].xpos = a->x >> 8;
-    vsprites[i].ypos = a->y >> 8;
-    vsprites[i].color = 2;
-  } else {
-    vsprites[i].ypos = 255; // offscreen
-  }
-}
-
 void draw_attackers() {
   byte i;
   for (i=0; i<MAX_ATTACKERS; i++) {
-    draw_attacker(i);
+    if (attacker_findex[i]) {
+      byte code = DIR_TO_CODE[attacker_dir[i] & 31];
+      vsprites[i].code = code + attacker_shape[i] + 14;
+      vsprites[i].xpos = attacker_x[i] >> 8;
+      vsprites[i].ypos = attacker_y[i] >> 8;
+      vsprites[i].color = 2;
+    } else {
+      vsprites[i].ypos = 255; // offscreen
+    }
   }
 }
 
-void return_attacker(AttackingEnemy* a) {
-  byte fi = a->findex-1;
+void return_attacker(byte i) {
+  byte fi = attacker_findex[i]-1;
   byte destx = get_attacker_x(fi);
   byte desty = get_attacker_y(fi);
-  byte ydist = desty - (a->y >> 8);
+  byte ydist = desty - (attacker_y[i] >> 8);
   // are we close to our formation slot?
   if (ydist == 0) {
     // convert back to formation enemy
-    formation[fi].shape = a->shape;
-    a->findex = 0;
+    formation_mask[fi / ENEMIES_PER_ROW] |= COLUMN_BIT[fi % ENEMIES_PER_ROW];
+    attacker_findex[i] = 0;
   } else {
-    a->dir = (ydist + 16) & 31;
-    a->x = destx << 8;
-    a->y += 128;
-  }
-}
-
-void fly_attacker(AttackingEnemy* a) {
-  a->x += isin(a->dir) * 2;
-  a->y += icos(a->dir) * 2;
-  if ((a->y >> 8) == 0) {
-    a->returning = 1;
+    attacker_dir[i] = (ydist + 16) & 31;
+    attacker_x[i] = destx << 8;
+    attacker_y[i] += 128;
   }
 }
 
 void move_attackers() {
   byte i;
   for (i=0; i<MAX_ATTACKERS; i++) {
-    AttackingEnemy* a = &attackers[i];
-    if (a->findex) {
-      if (a->returning)
-        return_attacker(a);
-      else
-        fly_attacker(a);
+    if (attacker_findex[i]) {
+      if (attacker_returning[i]) {
+        return_attacker(i);
+      } else {
+        byte dir = attacker_dir[i];
+        attacker_x[i] += isin(dir) * 2;
+        attacker_y[i] += icos(dir) * 2;
+        if ((attacker_y[i] >> 8) == 0) {
+          attacker_returning[i] = 1;
+        }
+      }
     }
   }
 }
@@ -412,17 +425,16 @@ void move_attackers() {
 void think_attackers() {
   byte i;
   for (i=0; i<MAX_ATTACKERS; i++) {
-    AttackingEnemy* a = &attackers[i];
-    if (a->findex) {
+    if (attacker_findex[i]) {
       // rotate?
-      byte x = a->x >> 8;
-      byte y = a->y >> 8;
+      byte x = attacker_x[i] >> 8;
+      byte y = attacker_y[i] >> 8;
       // don't shoot missiles after player exploded
       if (y < 128 || player_exploding) {
         if (x < 112) {
-          a->dir++;
+          attacker_dir[i]++;
         } else {
-          a->dir--;
+          attacker_dir[i]--;
         }
       } else {
         // lower half of screen
@@ -439,23 +451,24 @@ void think_attackers() {
 
 void formation_to_attacker(byte formation_index) {
   byte i;
+  byte row = formation_index / ENEMIES_PER_ROW;
+  byte bit = COLUMN_BIT[formation_index % ENEMIES_PER_ROW];
   // out of bounds? return
   if (formation_index >= MAX_IN_FORMATION)
     return;
   // nobody in formation? return
-  if (!formation[formation_index].shape)
+  if (!(formation_mask[row] & bit))
     return;
   // find an empty attacker slot
   for (i=0; i<MAX_ATTACKERS; i++) {
-    AttackingEnemy* a = &attackers[i];
-    if (a->findex == 0) {
-      a->x = get_attacker_x(formation_index) << 8;
-      a->y = get_attacker_y(formation_index) << 8;
-      a->shape = formation[formation_index].shape;
-      a->findex = formation_index+1;
-      a->dir = 0;
-      a->returning = 0;
-      formation[formation_index].shape = 0;
+    if (attacker_findex[i] == 0) {
+      attacker_x[i] = get_attacker_x(formation_index) << 8;
+      attacker_y[i] = get_attacker_y(formation_index) << 8;
+      attacker_shape[i] = formation_shape[row];
+      attacker_findex[i] = formation_index+1;
+      attacker_dir[i] = 0;
+      attacker_returning[i] = 0;
+      formation_mask[row] &= ~bit;
       break;
     }
   }
@@ -568,8 +581,9 @@ void does_player_shoot_formation() {
     byte localx = xoffset - column * FORMATION_XSPACE;
     if (column < ENEMIES_PER_ROW && localx < 16) {
       char index = column + row * ENEMIES_PER_ROW;
-      if (formation[index].shape) {
-        formation[index].shape = 0;
+      byte bit = COLUMN_BIT[column];
+      if (formation_mask[row] & bit) {
+        formation_mask[row] &= ~bit;
         enemies_left--;
         blowup_at(get_attacker_x(index), get_attacker_y(index));
         hide_player_missile();
@@ -584,14 +598,17 @@ void does_player_shoot_attacker() {
   byte my = 255 - missiles[7].ypos; // missiles are Y-backwards
   byte i;
   for (i=0; i<MAX_ATTACKERS; i++) {
-    AttackingEnemy* a = &attackers[i];
-    if (a->findex && in_rect(mx, my, a->x >> 8, a->y >> 8, 16, 16)) {
-      blowup_at(a->x >> 8, a->y >> 8);
-      a->findex = 0;
-      enemies_left--;
-      hide_player_missile();
-      add_score(5);
-      break;
+    if (attacker_findex[i]) {
+      byte x = attacker_x[i] >> 8;
+      byte y = attacker_y[i] >> 8;
+      if (in_rect(mx, my, x, y, 16, 16)) {
+        blowup_at(x, y);
+        attacker_findex[i] = 0;
+        enemies_left--;
+        hide_player_missile();
+        add_score(5);
+        break;
+      }
     }
   }
 }
@@ -617,7 +634,7 @@ void new_attack_wave() {
   for (j=0; j<MAX_IN_FORMATION; j++) {
     i = (i+1) & (MAX_IN_FORMATION-1);
     // anyone there?
-    if (formation[i].shape) {
+    if (formation_mask[i / ENEMIES_PER_ROW] & COLUMN_BIT[i % ENEMIES_PER_ROW]) {
       formation_to_attacker(i);
       formation_to_attacker(i+1);
       formation_to_attacker(i+ENEMIES_PER_ROW);
@@ -657,7 +674,7 @@ void set_sounds() {
   // set diving sounds for spaceships
   enable = 0;
   for (i=0; i<3; i++) {
-    byte y = attackers[i].y >> 8;
+    byte y = attacker_y[i] >> 8;
     if (y >= 0x80) {
       set8910b(AY_PITCH_A_LO+i, y);
       set8910b(AY_ENV_VOL_A+i, 7);
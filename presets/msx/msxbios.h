@@ -76,6 +76,8 @@ uint8_t __at(0xf3f7) REPCNT;
 uint8_t* __at(0xf3f8) PUTPNT;
 //Address in the keyboard buffer where the next character is read
 uint8_t* __at(0xf3fa) GETPNT;
+//Software clock, counted up by the BIOS in every VDP interrupt
+uint16_t __at(0xfc9e) JIFFY;
 
 /// FUNCTIONS
 
@@ -3,6 +3,8 @@
 #include <string.h>
 #include <stdint.h>
 
+#pragma opt_code_speed
+
 #include "msxbios.h"
 //#link "msxbios.c"
 
@@ -100,6 +102,34 @@ typedef enum { D_RIGHT, D_DOWN, D_LEFT, D_UP } dir_t;
 const char DIR_X[4] = { 1, 0, -1, 0 };
 const char DIR_Y[4] = { 0, 1, 0, -1 };
 
+// OCCUPANCY MAP
+
+// one bit per cell, 4 bytes per column, set for the walls and
+// everything the players left behind; kept up to date as they move so
+// the AI doesn't have to read the screen
+#define MAP_COLS 40 // widest text mode
+
+byte occupied[MAP_COLS*4];
+
+const byte BITMASK[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+
+#define CELL_OFS(x,y) ((x)*4 + ((y)>>3))
+#define SET_OCCUPIED(x,y) (occupied[CELL_OFS(x,y)] |= BITMASK[(y)&7])
+
+void init_occupied() {
+  byte x,y;
+  memset(occupied, 0, sizeof(occupied));
+  // everything but the inside of the box is taken
+  for (x=0; x<MAP_COLS; x++) {
+    for (y=0; y<32; y++) {
+      if (x == 0 || x >= COLS-1 || y <= 1 || y >= ROWS-1)
+        SET_OCCUPIED(x, y);
+    }
+  }
+  SET_OCCUPIED(players[0].x, players[0].y);
+  SET_OCCUPIED(players[1].x, players[1].y);
+}
+
 void init_game() {
   memset(players, 0, sizeof(players));
   players[0].head_attr = CHAR('1');
@@ -128,6 +158,7 @@ void move_player(Player* p) {
   p->y += DIR_Y[p->dir];
   if (getchar(p->x, p->y) != CHAR(' '))
     p->collided = 1;
+  SET_OCCUPIED(p->x, p->y);
   draw_player(p);
 }
 
@@ -145,31 +176,134 @@ void human_control(Player* p) {
   }
 }
 
-byte ai_try_dir(Player* p, dir_t dir, byte shift) {
-  byte x,y;
-  dir &= 3;
-  x = p->x + (DIR_X[dir] << shift);
-  y = p->y + (DIR_Y[dir] << shift);
-  if (x < 29 && y < 27 && getchar(x, y) == CHAR(' ')) {
-    p->dir = dir;
-    return 1;
-  } else {
-    return 0;
+// AI
+
+// The AI counts the free cells it can reach after each move, nearest
+// first, and takes the move with the most room.  Counting stops at
+// FILL_LIMIT cells per move, which bounds the time it takes: with 24,
+// both players' decisions take at most 2 frames, inside the MAX_SPEED
+// frames between moves.
+#ifndef FILL_LIMIT
+#define FILL_LIMIT 24
+#endif
+
+byte fill_ofs[FILL_LIMIT];	// queue: byte in occupied
+byte fill_mask[FILL_LIMIT];	// and bit in that byte
+byte fill_tail;
+
+// visit a cell and queue it, unless it's taken or visited already
+#define FILL_CELL(o,m) \
+  if (!(occupied[o] & (m))) { \
+    occupied[o] |= (m); \
+    fill_ofs[fill_tail] = (o); \
+    fill_mask[fill_tail] = (m); \
+    if (++fill_tail == FILL_LIMIT) return FILL_LIMIT; \
   }
+
+// count the free cells reachable from x,y, up to FILL_LIMIT; the
+// cells stay marked in occupied until unfill(), and the walls keep
+// it on the map
+byte free_space(byte x, byte y) {
+  static byte head, ofs, mask;
+  fill_tail = 0;
+  FILL_CELL(CELL_OFS(x,y), BITMASK[y&7]);
+  for (head=0; head != fill_tail; head++) {
+    ofs = fill_ofs[head];
+    mask = fill_mask[head];
+    FILL_CELL(ofs-4, mask);
+    FILL_CELL(ofs+4, mask);
+    if (mask == 0x80) {
+      FILL_CELL(ofs+1, 0x01);
+    } else {
+      FILL_CELL(ofs, mask<<1);
+    }
+    if (mask == 0x01) {
+      FILL_CELL(ofs-1, 0x80);
+    } else {
+      FILL_CELL(ofs, mask>>1);
+    }
+  }
+  return fill_tail;
+}
+
+// free the cells the last count visited
+void unfill() {
+  byte i;
+  for (i=0; i<fill_tail; i++)
+    occupied[fill_ofs[i]] &= ~fill_mask[i];
 }
 
+#define IS_MARKED(map,x,y) (map[CELL_OFS(x,y)] & BITMASK[(y)&7])
+
+// the moves the AI can make: straight on and the two turns
+byte move_x[3];
+byte move_y[3];
+byte move_room[3];
+// the cells next to the other player's head that were free
+byte blocked_ofs[4];
+byte blocked_mask[4];
+
 void ai_control(Player* p) {
-  dir_t dir;
+  Player* other = &players[p == players];
+  byte i, j, x, y, dir, walls;
+  byte nblocked = 0;
+  byte best = 0;
+  byte best_walls = 0;
+  byte best_dir = p->dir;
   if (p->human) return;
-  dir = p->dir;
-  if (!ai_try_dir(p, dir, 0)) {
-    ai_try_dir(p, dir+1, 0);
-    ai_try_dir(p, dir-1, 0);
-  } else {
-    ai_try_dir(p, dir-1, 0) && ai_try_dir(p, dir-1, 1+(rand() & 3));
-    ai_try_dir(p, dir+1, 0) && ai_try_dir(p, dir+1, 1+(rand() & 3));
-    ai_try_dir(p, dir, rand() & 3);
+  // keep out of the other player's way
+  for (dir=0; dir<4; dir++) {
+    x = other->x + DIR_X[dir];
+    y = other->y + DIR_Y[dir];
+    if (!IS_MARKED(occupied, x, y)) {
+      blocked_ofs[nblocked] = CELL_OFS(x,y);
+      blocked_mask[nblocked++] = BITMASK[y&7];
+      SET_OCCUPIED(x, y);
+    }
+  }
+  for (i=0; i<3; i++) {
+    dir = (p->dir + (i == 2 ? 3 : i)) & 3;
+    x = move_x[i] = p->x + DIR_X[dir];
+    y = move_y[i] = p->y + DIR_Y[dir];
+    move_room[i] = IS_MARKED(occupied, x, y) ? 0 : 0xff;
   }
+  // count each region once: the moves a count got to share its room,
+  // and each count starts from the cells that were free
+  for (i=0; i<3; i++) {
+    if (move_room[i] == 0xff) {
+      move_room[i] = free_space(move_x[i], move_y[i]);
+      for (j=i+1; j<3; j++) {
+        if (move_room[j] == 0xff && IS_MARKED(occupied, move_x[j], move_y[j]))
+          move_room[j] = move_room[i];
+      }
+      unfill();
+    }
+  }
+  for (i=0; i<nblocked; i++)
+    occupied[blocked_ofs[i]] &= ~blocked_mask[i];
+  // most room wins; then keeping close to walls, which leaves fewer holes
+  for (i=0; i<3; i++) {
+    dir = (p->dir + (i == 2 ? 3 : i)) & 3;
+    x = move_x[i];
+    y = move_y[i];
+    if (!move_room[i]) {
+      if (!best && !IS_MARKED(occupied, x, y))
+        best_dir = dir; // better than a wall
+      continue;
+    }
+    // x,y is free, so it's inside the box and its neighbors are on
+    // the map (and a coin toss between moves that are the same)
+    walls = rand() & 1;
+    for (j=0; j<4; j++) {
+      if (IS_MARKED(occupied, (byte)(x + DIR_X[j]), (byte)(y + DIR_Y[j]))) walls += 2;
+    }
+    if (move_room[i] > best || (move_room[i] == best && walls > best_walls)) {
+      best = move_room[i];
+      best_walls = walls;
+      best_dir = dir;
+    }
+  }
+  p->dir = best_dir;
 }
 
 byte gameover;
@@ -191,12 +325,15 @@ void flash_colliders() {
 
 void make_move() {
   byte i;
+  word start = JIFFY;
+  // think first, so the frames it takes can come out of the wait
+  ai_control(&players[0]);
+  ai_control(&players[1]);
   for (i=0; i<frames_per_move; i++) {
     human_control(&players[0]);
-    delay(1);
+    if ((word)(JIFFY - start) <= i)
+      delay(1);
   }
-  ai_control(&players[0]);
-  ai_control(&players[1]);
   // if players collide, 2nd player gets the point
   move_player(&players[1]);
   move_player(&players[0]);
@@ -222,6 +359,7 @@ void play_round() {
   reset_players();
   CLS();
   draw_playfield();
+  init_occupied();
   while (1) {
     make_move();
     if (players[0].collided || players[1].collided) break;
@@ -150,6 +150,57 @@ void clear_sprite(const byte* src, byte x, byte y) {
   }
 }
 
+// move a sprite from (ox,oy) to (x,y): when the two places overlap,
+// clear only the bytes of the old place that the new one doesn't cover
+// instead of clearing it and drawing it again
+void move_sprite(const byte* src, byte ox, byte oy, byte x, byte y) {
+  byte i,j;
+  byte* dest;
+  byte w = src[0];
+  byte h = src[1];
+  byte top = x > ox ? x - ox : 0;
+  byte bottom = ox > x ? ox - x : 0;
+  byte left = y > oy ? y - oy : 0;
+  byte right = oy > y ? oy - y : 0;
+  if (top >= h || bottom >= h || left >= w || right >= w) {
+    clear_sprite(src, ox, oy);
+    draw_sprite(src, x, y);
+    return;
+  }
+  src += 2;
+  // old rows above and below the new ones
+  dest = &vidmem[ox][oy];
+  for (j=0; j<top; j++) {
+    for (i=0; i<w; i++) {
+      *dest++ = 0;
+    }
+    dest += 32-w;
+  }
+  dest = &vidmem[x+h][oy];
+  for (j=0; j<bottom; j++) {
+    for (i=0; i<w; i++) {
+      *dest++ = 0;
+    }
+    dest += 32-w;
+  }
+  // the new rows, and the old bytes beside them on rows both cover
+  dest = &vidmem[x][y];
+  for (j=0; j<h; j++) {
+    if ((byte)(x + j - ox) < h) {
+      for (i=1; i<=left; i++) {
+        dest[-i] = 0;
+      }
+      for (i=0; i<right; i++) {
+        dest[w+i] = 0;
+      }
+    }
+    for (i=0; i<w; i++) {
+      *dest++ = *src++;
+    }
+    dest += 32-w;
+  }
+}
+
 void draw_char(char ch, byte x, byte y) {
   byte i;
   const byte* src = &font8x8[(ch-LOCHAR)][0];
@@ -342,12 +393,14 @@ void delete_enemy(Enemy* e) {
 
 void update_next_enemy() {
   Enemy* e;
+  byte ox,oy;
   if (enemy_index >= num_enemies) {
     enemy_index = 0;
     memcpy(&this_mode, &next_mode, sizeof(this_mode));
   }
   e = &enemies[enemy_index];
-  clear_sprite(e->shape, e->x, e->y);
+  ox = e->x;
+  oy = e->y;
   if (this_mode.down) {
     // if too close to ground, end game
     if (--e->y < 5) {
@@ -370,7 +423,7 @@ void update_next_enemy() {
       }
     }
   }
-  draw_sprite(e->shape, e->x, e->y);
+  move_sprite(e->shape, ox, oy, e->x, e->y);
   enemy_index++;
 }
 
@@ -468,6 +521,7 @@ void move_bomb() {
 }
 
 byte frame;
+byte drawn_player_x;
 
 void move_player() {
   if (attract) {
@@ -479,13 +533,18 @@ void move_player() {
       fire_bullet();
     }
   }
-  draw_sprite(player_bitmap, player_x, 1);
+  // the bitmap has blank edges, so drawing it erases the old one
+  if (player_x != drawn_player_x) {
+    draw_sprite(player_bitmap, player_x, 1);
+    drawn_player_x = player_x;
+  }
 }
 
 void play_round() {
   watchdog_strobe = 0;
   draw_playfield();
   player_x = 96;
+  drawn_player_x = 0xff;
   bullet_y = 0;
   bomb_y = 0;
   frame = 0;
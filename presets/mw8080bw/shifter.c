@@ -12,15 +12,53 @@ __sfr __at (0x6) watchdog_strobe;
 
 byte __at (0x2400) vidmem[224][32]; // 256x224x1 video memory
 
+// 1 = erase and redraw each moving sprite in one pass over the
+// rectangle covering its old and new position, skip the others
+// 0 = clear every sprite, then draw it again
+#ifndef DIRTY_RECTS
+#define DIRTY_RECTS 1
+#endif
+
+void scanline96() __interrupt;
+void scanline224() __interrupt;
+
 void main();
 // start routine @ 0x0
 // set stack pointer, enable interrupts
-void start() {
+void start() __naked {
 __asm
-        LD      SP,#0x2400
-        DI
+	LD      SP,#0x2400
+        EI
+        NOP
+  	JP	_main
 __endasm;
-        main();
+}
+
+// scanline 96 interrupt @ 0x8
+// we don't have enough bytes to make this an interrupt
+// because the next routine is at 0x10
+void _RST_8() __naked {
+__asm
+	NOP
+        NOP
+        NOP
+        NOP
+        NOP
+  	JP	_scanline96
+__endasm;
+}
+
+volatile byte ticks; // half frames (120 Hz)
+
+// scanline 224 interrupt @ 0x10
+// this one, we make an interrupt so it saves regs.
+void scanline224() __interrupt {
+  ticks++;
+}
+
+// scanline 96 function, saves regs
+void scanline96() __interrupt {
+  ticks++;
 }
 
 const byte bitmap1[] =
@@ -28,6 +66,11 @@ const byte bitmap1[] =
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x80,0xFB,0xFF,0xF0,0x01,0x00,0x00,0x00,0x00,0x40,0x04,0x80,0xF3,0x01,0x00,0x00,0x00,0x00,0xB8,0x00,0x00,0xFA,0x01,0x00,0x00,0x00,0x00,0x06,0xFE,0x03,0xFA,0x01,0x00,0x00,0x00,0x00,0x83,0xFF,0x03,0xFD,0x01,0x80,0x00,0x00,0x00,0x81,0xCF,0x00,0xDC,0x00,0x80,0x01,0xC0,0x9F,0x01,0x00,0x00,0xDC,0x00,0x80,0x01,0x30,0xE0,0x00,0x00,0x00,0xD8,0x00,0xC0,0x01,0x0C,0x84,0x41,0x00,0x00,0x98,0x01,0xC0,0x07,0x04,0xF8,0xC2,0x00,0x00,0x38,0x03,0xC0,0x07,0x06,0x00,0x43,0x00,0x00,0x72,0x02,0xC0,0x07,0x02,0x80,0x00,0xF8,0x0F,0xE4,0x02,0xE0,0xFF,0x04,0xF8,0x00,0xFE,0x1F,0xE8,0x04,0xE0,0x03,0x07,0x80,0x00,0xBE,0x0F,0xEC,0x05,0xE0,0x01,0x06,0x80,0x00,0x3C,0x00,0x92,0x05,0xE0,0x00,0x0A,0xFF,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0x24,0x08,0x01,0x00,0x00,0x00,0x07,0x60,0x00,0xC6,0x88,0x01,0x00,0x00,0x00,0x07,0x60,0x00,0x02,0x7E,0x03,0x00,0x00,0x80,0x07,0x60,0x00,0xFE,0x27,0x02,0x00,0x00,0x80,0x07,0x60,0x00,0xC1,0x43,0x02,0x00,0x00,0xC0,0x07,0x70,0xC0,0xC0,0x43,0x04,0x00,0x00,0xC0,0x03,0x70,0x40,0xC1,0x67,0x08,0x00,0x00,0xE0,0x03,0x70,0x00,0xE1,0x7F,0x10,0x00,0x1C,0xF0,0x01,0xF0,0x00,0xFA,0xFF,0xA0,0x01,0x7F,0xFE,0x00,0xF0,0x00,0xE2,0x1F,0xC1,0x60,0xFE,0x7F,0x00,0xE0,0x81,0x87,0x0F,0x82,0x81,0xFE,0x3F,0x00,0xE0,0x83,0xC8,0x0F,0x02,0xA5,0xFE,0x0F,0x00,0xE0,0x7F,0xF9,0xBF,0x13,0x9F,0xFD,0x00,0x00,0xE0,0x03,0x81,0xFF,0x1F,0x61,0x00,0x00,0x06,0xE0,0x03,0x02,0xFE,0x8F,0x01,0x00,0x6C,0x04,0x80,0x01,0x02,0xFC,0x83,0x01,0x00,0xC0,0x04,0x80,0x01,0x03,0x0E,0x81,0x00,0x04,0x80,0x03,0x80,0x01,0xFE,0x01,0x62,0x50,0x08,0x00,0x00,0x80,0x01,0x48,0x00,0x1C,0x80,0x08,0x00,0x00,0x80,0x03,0x50,0x00,0x1C,0x00,0x07,0x00,0x00,0x80,0x03,0x50,0x00,0x34,0x00,0x00,0x00,0x00,0x80,0x03,0x50,0x00,0x24,0x00,0x00,0x00,0x00,0x80,0x07,0x90,0x00,0x3A,0x00,0x00,0x00,0x00,0x80,0x0F,0x98,0x00,0x10,0x00,0x00,0x00,0x00,0x80,0x3F,0x0C,0x07,0x10,0x00,0x00,0x00,0x00,0x00,0xC1,0x03,0x18,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}
 ;
 
+const byte enemy1_bitmap[] =
+{2,17,/*{w:16,h:17,bpp:1,xform:"rotate(-90deg)"}*/0x00,0x00,0x00,0x0c,0x04,0x1e,0x46,0x3f,0xb8,0x7f,0xb0,0x7f,0xba,0x7f,0xfd,0x3f,0xfc,0x07,0xfc,0x07,0xfd,0x3f,0xba,0x7f,0xb0,0x7f,0xb8,0x7f,0x46,0x3f,0x04,0x1e,0x00,0x0c};
+const byte enemy2_bitmap[] =
+{2,16,/*{w:16,h:16,bpp:1,xform:"rotate(-90deg)"}*/0x26,0x00,0x59,0x10,0x10,0x30,0x33,0x18,0xe6,0x61,0xc4,0x56,0x03,0x03,0xdc,0x03,0xdc,0x03,0x03,0x03,0xc4,0x56,0xe6,0x61,0x33,0x18,0x10,0x30,0x59,0x10,0x26,0x00};
+
 void draw_shifted_sprite(const byte* src, byte x, byte y) {
   byte i,j;
   byte* dest = &vidmem[x][y>>3];
@@ -46,17 +89,178 @@ void draw_shifted_sprite(const byte* src, byte x, byte y) {
   }
 }
 
+// clear h rows of n bytes, return the start of the next row
+byte* clear_rows(byte* dest, byte h, byte n) {
+  byte i;
+  while (h--) {
+    for (i=0; i<n; i++) {
+      *dest++ = 0;
+    }
+    dest += 32-n;
+  }
+  return dest;
+}
+
+void clear_shifted_sprite(const byte* src, byte x, byte y) {
+  clear_rows(&vidmem[x][y>>3], src[1], src[0]+1);
+}
+
 void clrscr() {
   memset(vidmem, 0, sizeof(vidmem));
 }
 
+/// SPRITES
+
+typedef struct {
+  const byte* shape;		// what to show, 0 = nothing
+  byte x,y;
+  const byte* old_shape;	// what is on the screen now
+  byte old_x,old_y;
+} Sprite;
+
+// Draw sprite s at its new place.  A sprite covers h rows starting at
+// x and w+1 bytes starting at y/8.  When the old and the new rectangle
+// meet, only the bytes of the old one that the new one doesn't cover
+// are cleared, instead of clearing the old rectangle and then drawing
+// the new one: that is fewer writes and nothing on the screen is ever
+// blank in between.
+void update_sprite(Sprite* s) {
+  const byte* src = s->shape;
+  const byte* old = s->old_shape;
+  byte x = s->x;
+  byte y = s->y;
+  byte ox = s->old_x;
+  byte oy = s->old_y;
+  byte i,j,w,h,n,top,bottom,left,right;
+  byte* dest;
+  if (src == old && x == ox && y == oy)
+    return;
+  s->old_shape = src;
+  s->old_x = x;
+  s->old_y = y;
+  if (!src) {
+    if (old) {
+      clear_shifted_sprite(old, ox, oy);
+    }
+    return;
+  }
+  if (!old) {
+    draw_shifted_sprite(src, x, y);
+    return;
+  }
+  w = src[0];
+  h = src[1];
+  // rows and bytes of the old rectangle past the new one on each side
+  top = x > ox ? x - ox : 0;
+  bottom = ox + old[1] > x + h ? ox + old[1] - x - h : 0;
+  left = y/8 > oy/8 ? y/8 - oy/8 : 0;
+  right = oy/8 + old[0] > y/8 + w ? oy/8 + old[0] - y/8 - w : 0;
+  if (top >= old[1] || bottom >= old[1] || left > old[0] || right > old[0]) {
+    // apart
+    clear_shifted_sprite(old, ox, oy);
+    draw_shifted_sprite(src, x, y);
+    return;
+  }
+  // old rows above and below the new ones
+  n = old[0] + 1;
+  clear_rows(&vidmem[ox][oy/8], top, n);
+  clear_rows(&vidmem[x + h][oy/8], bottom, n);
+  // the new rows, and the old bytes beside them on rows both cover
+  dest = &vidmem[x][y/8];
+  bitshift_offset = y & 7;
+  src += 2;
+  for (j=0; j<h; j++) {
+    if ((byte)(x + j - ox) < old[1]) {
+      for (i=1; i<=left; i++) {
+        dest[-i] = 0;
+      }
+      for (i=0; i<right; i++) {
+        dest[w+1+i] = 0;
+      }
+    }
+    bitshift_value = 0;
+    for (i=0; i<w; i++) {
+      bitshift_value = *src++;
+      *dest++ = bitshift_read;
+    }
+    bitshift_value = 0;
+    *dest++ = bitshift_read;
+    dest += 31-w;
+  }
+}
+
+/// DEMO
+
+#define NSPRITES 9
+
+Sprite sprites[NSPRITES];
+sbyte speed[NSPRITES];
+
+void init_sprites() {
+  byte i;
+  Sprite* s = sprites;
+  for (i=0; i<NSPRITES-1; i++) {
+    s->shape = (i & 1) ? enemy2_bitmap : enemy1_bitmap;
+    s->x = i*20;
+    s->y = i*24;
+    s->old_shape = 0;
+    // every third one stays put
+    speed[i] = (i % 3 == 2) ? 0 : (i & 1) ? -1-(i&2) : 1+(i&2);
+    s++;
+  }
+  s->shape = bitmap1;
+  s->x = 164;
+  s->y = 0;
+  s->old_shape = 0;
+  speed[i] = 1;
+}
+
+void move_sprites() {
+  byte i;
+  Sprite* s = sprites;
+  for (i=0; i<NSPRITES; i++) {
+    sbyte dy = speed[i];
+    byte limit = 247 - s->shape[0]*8;
+    // bounce off the edges
+    if ((dy < 0 && s->y < -dy) || (dy > 0 && s->y + dy > limit)) {
+      speed[i] = dy = -dy;
+    }
+    s->y += dy;
+#if DIRTY_RECTS
+    update_sprite(s);
+#else
+    if (s->old_shape) {
+      clear_shifted_sprite(s->old_shape, s->old_x, s->old_y);
+    }
+    draw_shifted_sprite(s->shape, s->x, s->y);
+    s->old_shape = s->shape;
+    s->old_x = s->x;
+    s->old_y = s->y;
+#endif
+    s++;
+  }
+}
+
+// bar along the top of the screen, 8 pixels per 1/120 second
+void show_frame_time(byte t) {
+  byte i;
+  byte* dest = &vidmem[0][31];
+  t *= 8;
+  for (i=0; i<128; i++) {
+    *dest = i < t ? 0x0f : 0;
+    dest += 32;
+  }
+}
+
 void main() {
-  byte x;
-  // TODO: clear memory
+  byte start_ticks;
+  ticks = 0;
   clrscr();
-  for (x=0; x<255; x++) {
-    draw_shifted_sprite(bitmap1, x, x);
+  init_sprites();
+  while (1) {
+    start_ticks = ticks;
+    move_sprites();
+    show_frame_time(ticks - start_ticks);
     watchdog_strobe++;
   }
-  main();
 }
@@ -0,0 +1,396 @@
+
+#include <string.h>
+
+#include "aysound.h"
+
+#pragma opt_code_speed
+
+__sfr __at (0x1) ay8910_reg;
+__sfr __at (0x2) ay8910_data;
+
+// 440.5 1.79270256703 49
+const word note_table[64] = {
+4305, 4063, 3835, 3620, 3417, 3225, 3044, 2873, 2712, 2560, 2416, 2280, 2152, 2032, 1918, 1810, 1708, 1612, 1522, 1437, 1356, 1280, 1208, 1140, 1076, 1016, 959, 905, 854, 806, 761, 718, 678, 640, 604, 570, 538, 508, 479, 452, 427, 403, 380, 359, 339, 320, 302, 285, 269, 254, 240, 226, 214, 202, 190, 180, 169, 160, 151, 143, 135, 127, 120, 113, };
+
+// the envelope shape register is left out, since writing it
+// restarts the envelope even when the value is the same
+byte ay_regs[AY_ENV_SHAPE];
+word ay_dirty;
+
+typedef struct {
+  byte priority;	// 0 = music or free
+  byte volume;		// 0 = silent
+  byte decay_count;
+  byte decay;		// ticks per volume step
+  sbyte sweep;
+  byte noise;
+} AYVoice;
+
+static AYVoice voices[AY_VOICES];
+
+static const byte* song_start;
+static const byte* song_ptr;
+static byte song_wait;
+static byte song_volume;
+static byte song_decay;
+
+void ay_init() {
+  byte i;
+  memset(voices, 0, sizeof(voices));
+  memset(ay_regs, 0, sizeof(ay_regs));
+  ay_regs[AY_ENABLE] = 0xff;
+  for (i=0; i<AY_ENV_SHAPE; i++) {
+    ay8910_reg = i;
+    ay8910_data = ay_regs[i];
+  }
+  ay_dirty = 0;
+  song_ptr = NULL;
+}
+
+void ay_start_music(const byte* song) {
+  song_start = song_ptr = song;
+  song_wait = 0;
+  song_volume = 15;
+  song_decay = 1;
+}
+
+byte ay_music_playing() {
+  return song_ptr != NULL;
+}
+
+static const byte period_bits[AY_VOICES] = { 0x03, 0x0c, 0x30 };
+
+static void set_period(byte ch, word period) {
+  ay_regs[AY_PITCH_A_LO+ch*2] = period & 0xff;
+  ay_regs[AY_PITCH_A_HI+ch*2] = period >> 8;
+  ay_dirty |= period_bits[ch];
+}
+
+byte ay_play_sound(const AYSound* sound, byte priority) {
+  byte ch;
+  byte best = AY_NO_VOICE;
+  byte best_priority = priority;
+  byte best_volume = 16;
+  AYVoice* v = voices;
+  for (ch=0; ch<AY_VOICES; ch++, v++) {
+    if (v->volume == 0) {
+      best = ch;
+      break;
+    }
+    if (v->priority < best_priority ||
+        (v->priority == best_priority && best != AY_NO_VOICE &&
+         v->volume < best_volume)) {
+      best = ch;
+      best_priority = v->priority;
+      best_volume = v->volume;
+    }
+  }
+  if (best != AY_NO_VOICE) {
+    v = &voices[best];
+    v->priority = priority;
+    v->volume = sound->volume;
+    v->decay = v->decay_count = sound->decay;
+    v->sweep = sound->sweep;
+    v->noise = sound->noise;
+    set_period(best, sound->period);
+  }
+  return best;
+}
+
+// send the registers marked in ay_dirty
+static void ay_flush() __naked {
+__asm
+	ld	hl,#_ay_regs-1
+	ld	bc,#0xff00+_ay8910_reg	; b = register - 1, c = port
+	ld	a,(_ay_dirty)
+	call	00001$
+	ld	hl,#_ay_regs+7
+	ld	b,#7
+	ld	a,(_ay_dirty+1)
+	call	00001$
+	ld	hl,#0
+	ld	(_ay_dirty),hl
+	ret
+00001$:				; a = marks for the 8 registers after b
+	ld	e,a
+00002$:
+	inc	hl
+	inc	b
+	srl	e
+	jr	c,00003$
+	jr	nz,00002$
+	ret
+00003$:
+	out	(c),b
+	ld	a,(hl)
+	out	(_ay8910_data),a
+	jr	nz,00002$
+	ret
+__endasm;
+}
+
+// Start note a on the quietest voice not playing an effect, if any.
+static void play_note() __naked {
+__asm
+	ld	c,a
+	ld	hl,#_voices
+	ld	de,#0x10ff		; d = volume to beat, e = AY_NO_VOICE
+	ld	b,#0
+00001$:
+	ld	a,(hl)			; priority
+	or	a
+	jr	nz,00002$
+	inc	hl
+	ld	a,(hl)			; volume
+	dec	hl
+	cp	d
+	jr	nc,00002$
+	ld	d,a
+	ld	e,b
+00002$:
+	ld	a,l			; next voice
+	add	a,#6
+	ld	l,a
+	jr	nc,00003$
+	inc	h
+00003$:
+	inc	b
+	ld	a,b
+	cp	#AY_VOICES
+	jr	c,00001$
+	ld	a,e
+	inc	a
+	ret	z
+	ld	l,c			; period = note_table[note]
+	ld	h,#0
+	add	hl,hl
+	ld	bc,#_note_table
+	add	hl,bc
+	ld	c,(hl)
+	inc	hl
+	ld	b,(hl)
+	ld	d,#0
+	ld	hl,#_ay_regs		; AY_PITCH_A_LO+ch*2
+	add	hl,de
+	add	hl,de
+	ld	(hl),c
+	inc	hl
+	ld	(hl),b
+	ld	hl,#_period_bits
+	add	hl,de
+	ld	a,(_ay_dirty)
+	or	(hl)
+	ld	(_ay_dirty),a
+	ld	a,e			; &voices[ch].volume
+	add	a,a
+	add	a,e
+	add	a,a
+	ld	e,a
+	ld	hl,#_voices+1
+	add	hl,de
+	ld	a,(_song_volume)
+	ld	(hl),a
+	inc	hl
+	ld	a,(_song_decay)
+	ld	(hl),a			; decay_count
+	inc	hl
+	ld	(hl),a			; decay
+	inc	hl
+	xor	a
+	ld	(hl),a			; sweep
+	inc	hl
+	ld	(hl),a			; noise
+	ret
+__endasm;
+}
+
+static void play_song() __naked {
+__asm
+	ld	hl,#_song_wait
+	ld	a,(hl)
+	or	a
+	jr	z,00001$
+	dec	(hl)
+	ret
+00001$:
+	ld	hl,(_song_ptr)
+00002$:
+	ld	a,(hl)
+	inc	hl
+	cp	#SONG_VOLUME
+	jr	nc,00003$
+	push	hl
+	call	_play_note
+	pop	hl
+	jr	00002$
+00003$:
+	cp	#SONG_DECAY
+	jr	nc,00004$
+	and	#15
+	ld	(_song_volume),a
+	jr	00002$
+00004$:
+	cp	#SONG_WAIT
+	jr	nc,00005$
+	and	#15
+	inc	a
+	ld	(_song_decay),a
+	jr	00002$
+00005$:
+	cp	#SONG_WAIT+64
+	jr	nc,00006$
+	and	#63
+	jr	z,00002$		; wait 0 ticks
+	dec	a			; this tick is one of them
+	ld	(_song_wait),a
+	ld	(_song_ptr),hl
+	ret
+00006$:
+	cp	#SONG_LOOP
+	jr	nz,00007$
+	ld	hl,(_song_start)
+	jr	00002$
+00007$:
+	ld	hl,#0			; SONG_END, or a code the format doesn't have
+	ld	(_song_ptr),hl
+	ret
+__endasm;
+}
+
+// Fade and sweep the voices and set their volume registers, marking
+// the registers that change.  Returns the mixer bits for AY_ENABLE.
+static byte update_voices() __naked {
+__asm
+	ld	hl,#_voices
+	ld	de,#_ay_regs+8		; AY_ENV_VOL_A
+	ld	bc,#0xff01		; b = mixer bits, c = voice bit
+00001$:
+	inc	hl			; volume
+	ld	a,(de)
+	cp	(hl)
+	jr	z,00002$
+	ld	a,(hl)
+	ld	(de),a
+	ld	a,(_ay_dirty+1)		; AY_ENV_VOL_A+ch
+	or	c
+	ld	(_ay_dirty+1),a
+00002$:
+	ld	a,(hl)
+	or	a
+	jr	nz,00003$
+	inc	hl			; silent: on to the next voice
+	inc	hl
+	inc	hl
+	inc	hl
+	inc	hl
+	jr	00007$
+00003$:
+	ld	a,b			; tone on
+	xor	c
+	ld	b,a
+	inc	hl			; decay_count
+	dec	(hl)
+	jr	nz,00005$
+	inc	hl
+	ld	a,(hl)			; decay
+	dec	hl
+	ld	(hl),a
+	dec	hl
+	dec	(hl)			; volume
+	jr	nz,00004$
+	dec	hl
+	ld	(hl),#0			; priority: free for music again
+	inc	hl
+00004$:
+	inc	hl
+00005$:
+	inc	hl
+	inc	hl			; sweep
+	ld	a,(hl)
+	inc	hl			; noise
+	or	(hl)
+	jr	z,00006$
+	dec	hl
+	ld	a,(hl)
+	or	a
+	call	nz,00010$
+	inc	hl
+	ld	a,(hl)
+	or	a
+	jr	z,00006$
+	ld	(_ay_regs+6),a		; AY_NOISE_PERIOD
+	ld	a,(_ay_dirty)
+	or	#0x40
+	ld	(_ay_dirty),a
+	ld	a,c			; noise on
+	rlca
+	rlca
+	rlca
+	xor	b
+	ld	b,a
+00006$:
+	inc	hl			; next voice
+00007$:
+	inc	de
+	sla	c
+	bit	3,c			; 1 << AY_VOICES
+	jr	z,00001$
+	ld	l,b
+	ret
+; add the sweep in a to the period of voice c and mark it
+00010$:
+	push	hl
+	push	de
+	ld	e,a
+	rla
+	sbc	a,a
+	ld	d,a
+	ld	a,c			; &ay_regs[AY_PITCH_A_LO+ch*2]
+	and	#6
+	add	a,#<(_ay_regs)
+	ld	l,a
+	adc	a,#>(_ay_regs)
+	sub	l
+	ld	h,a
+	ld	a,(hl)
+	add	a,e
+	ld	(hl),a
+	inc	hl
+	ld	a,(hl)
+	adc	a,d
+	ld	(hl),a
+	ld	a,c
+	cp	#2
+	ld	a,#0x03
+	jr	c,00011$
+	ld	a,#0x0c
+	jr	z,00011$
+	ld	a,#0x30
+00011$:
+	ld	hl,#_ay_dirty
+	or	(hl)
+	ld	(hl),a
+	pop	de
+	pop	hl
+	ret
+__endasm;
+}
+
+void ay_update() __naked {
+__asm
+	ld	hl,(_song_ptr)
+	ld	a,h
+	or	l
+	call	nz,_play_song
+	call	_update_voices
+	ld	a,l
+	ld	hl,#_ay_regs+7		; AY_ENABLE
+	cp	(hl)
+	jr	z,00001$
+	ld	(hl),a
+	ld	hl,#_ay_dirty
+	set	7,(hl)
+00001$:
+	jp	_ay_flush
+__endasm;
+}
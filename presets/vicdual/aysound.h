@@ -0,0 +1,84 @@
+
+#ifndef _AYSOUND_H
+#define _AYSOUND_H
+
+// Sound driver for the AY-3-8910: plays a song and sound effects
+// on the three voices.  Call ay_update() at a fixed rate; vicdual has
+// no frame interrupt, so music.c calls it once per main loop tick.
+// It keeps a shadow of the chip registers and a mask of the ones that
+// changed, and only writes those.  Budget about 1700 T-states per call
+// on average and 4500 at most (a tick that starts three notes).
+
+typedef unsigned char byte;
+typedef unsigned short word;
+typedef signed char sbyte;
+
+typedef enum {
+  AY_PITCH_A_LO, AY_PITCH_A_HI,
+  AY_PITCH_B_LO, AY_PITCH_B_HI,
+  AY_PITCH_C_LO, AY_PITCH_C_HI,
+  AY_NOISE_PERIOD,
+  AY_ENABLE,
+  AY_ENV_VOL_A,
+  AY_ENV_VOL_B,
+  AY_ENV_VOL_C,
+  AY_ENV_PERI_LO, AY_ENV_PERI_HI,
+  AY_ENV_SHAPE
+} AY8910Register;
+
+#define AY_VOICES 3
+#define AY_NO_VOICE 0xff
+
+// Song format, one byte per event (tools/midi2song.py --ay):
+//   0x00-0x3f	play note_table[N] on the quietest music voice
+//   0x40-0x4f	notes after this start at volume N (default 15)
+//   0x50-0x5f	notes after this fade one step every N+1 ticks
+//   0x80-0xbf	wait N ticks
+//   0xc0-0xfd	not used: they stop the song, like 0xff
+//   0xfe	start the song over
+//   0xff	end of song
+#define SONG_VOLUME	0x40
+#define SONG_DECAY	0x50
+#define SONG_WAIT	0x80
+#define SONG_LOOP	0xfe
+#define SONG_END	0xff
+
+// a sound effect: a tone and/or noise that sweeps and fades out
+typedef struct {
+  word period;		// starting tone period
+  sbyte sweep;		// added to the period every tick
+  byte noise;		// noise period, 0 = tone only
+  byte volume;		// starting volume (1-15)
+  byte decay;		// ticks per volume step
+} AYSound;
+
+// register values for the chip; ay_update() sends the ones whose bit
+// is set in ay_dirty (bit N = register N) and clears the mask
+extern byte ay_regs[AY_ENV_SHAPE];
+extern word ay_dirty;
+
+// set a register for the next ay_update()
+#define ay_set_reg(reg,value) \
+  (ay_regs[reg] = (value), ay_dirty |= 1 << (reg))
+
+// note periods for the 1.79 MHz clock
+extern const word note_table[64];
+
+// silence the chip and reset the driver
+void ay_init(void);
+
+// start playing a song from the beginning (NULL stops the music)
+void ay_start_music(const byte* song);
+
+// is a song playing?
+byte ay_music_playing(void);
+
+// Play an effect with priority 1-255.  It takes a silent voice if there
+// is one, else the voice with the lowest priority below its own (music
+// has priority 0), quietest first.  Returns the voice or AY_NO_VOICE.
+byte ay_play_sound(const AYSound* sound, byte priority);
+
+// advance music and effects one tick and write changed registers
+void ay_update(void);
+
+#endif
@@ -9,6 +9,28 @@ byte __at (0xcbff) watchdog0x39;
 
 byte __at (0x0) vidmem[152][256]; // 256x304x4bpp video memory
 
+// blitter flags
+#define SRCSCREEN 0x1
+#define DSTSCREEN 0x2
+#define ESYNC 0x4
+#define FGONLY 0x8
+#define SOLID 0x10
+#define RSHIFT 0x20
+#define EVENONLY 0x40
+#define ODDONLY 0x80
+
+struct {
+  byte flags;
+  byte solid;
+  word sstart;
+  word dstart;
+  byte width;
+  byte height;
+} __at (0xca00) blitter;
+
+// uncomment to decode the TGA file with the CPU instead
+//#define USE_CPU_DECODER
+
 void main();
 
 // start routine @ 0x0
@@ -21,6 +43,8 @@ __endasm;
         main();
 }
 
+#ifdef USE_CPU_DECODER
+
 const byte example_tga[] = {
 0x00,0x01,0x09,0x00,0x00,0x08,0x00,0x18,0x00,0x00,0x00,0x00,0xc0,0x00,0x8b,0x00,0x08,0x00,0x00,0x00,0x00,0x32,0x29,0x2e,0x66,0x3b,0x4d,0x9f,0x42,0x57,0xc5,0x54,0xbe,0xe6,0xe4,0xe3,0xbe,0xab,0xb4,0xc1,0x9c,0x67,0xff,0x00,0xbf,0x00,0xff,0x00,0xbf,0x00,0xfc,0x00,0x01,0x04,0x04,0xc0,0x00,0xfb,0x00,0x82,0x04,0xc0,0x00,0xfb,0x00,0x82,0x04,0xc0,0x00,0xfa,0x00,0x82,0x04,0xc1,0x00,0xfa,0x00,0x82,0x04,0xc1,0x00,0xf9,0x00,0x82,0x04,0xc2,0x00,0xf8,0x00,0x82,0x04,0xc3,0x00,0xf8,0x00,0x82,0x04,0xc3,0x00,0xcd,0x00,0x03,0x04,0x04,0x00,0x00,0x83,0x04,0xa2,0x00,0x01,0x04,0x04,0xc4,0x00,0xcc,0x00,0x89,0x04,0xa0,0x00,0x82,0x04,0xc4,0x00,0xcc,0x00,0x89,
 0x04,0xa0,0x00,0x01,0x04,0x04,0xc5,0x00,0xcb,0x00,0x84,0x04,0x82,0x01,0x83,0x04,0x9e,0x00,0x82,0x04,0xc5,0x00,0xca,0x00,0x84,0x04,0x83,0x01,0x02,0x06,0x04,0x04,0x9f,0x00,0x01,0x04,0x04,0xc6,0x00,0xca,0x00,0x83,0x04,0x84,0x02,0x02,0x06,0x04,0x04,0x9e,0x00,0x82,0x04,0xc6,0x00,0xc9,0x00,0x83,0x04,0x02,0x02,0x02,0x03,0x82,0x04,0x01,0x06,0x04,0x9f,0x00,0x01,0x04,0x04,0xc7,0x00,0xc9,0x00,0x82,0x04,0x01,0x02,0x01,0x82,0x02,0x00,0x03,0x82,0x04,0x9a,0x00,0x01,0x04,0x04,0x82,0x00,0x01,0x04,0x04,0xc7,0x00,0xc8,0x00,0x83,0x04,0x04,0x01,0x02,0x02,0x03,0x03,0x82,0x04,0x99,0x00,0x83,0x04,0x03,0x00,0x00,0x04,0x04,0xc8,0x00,0xc8,0x00,0x82,0x04,0x01,
@@ -80,6 +104,452 @@ const byte example_tga[] = {
 0xb8,0x00,0xca,0x00,0x82,0x05,0x99,0x00,0x82,0x05,0x97,0x00,0x82,0x05,0xb9,0x00,0xff,0x00,0xbf,0x00,0xff,0x00,0xbf,0x00,0xff,0x00,0xbf,0x00
 };
 
+#else
+
+// generated from example_tga by tools/williams/tga2blit.py -z
+// example_tga: 192x139, 68 fills, 64 copies, 6913 bytes (TGA 7068 bytes)
+// measured load time: 124531 T-states (65843 CPU + 58688 blitter),
+// against 8469744 T-states for draw_tga(example_tga)
+const byte example_blit[6913] = {
+0x60,0x8b,0x08,0x00,0x09,0x4b,0x54,0x96,0xff,0xad,0x66,0x01,0x25,0x0e,0x01,0x02,
+0x04,0x01,0x24,0x12,0x01,0x02,0x04,0x01,0x37,0x12,0x01,0x01,0x04,0x01,0x30,0x13,
+0x01,0x01,0x04,0x01,0x37,0x13,0x01,0x02,0x44,0x01,0x3f,0x17,0x11,0x01,0x55,0x01,
+0x50,0x17,0x01,0x01,0x50,0x01,0x11,0x18,0x01,0x01,0x56,0x01,0x12,0x18,0x13,0x01,
+0x44,0x01,0x40,0x18,0x0d,0x01,0x66,0x01,0x26,0x2b,0x12,0x01,0x33,0x01,0x26,0x2c,
+0x23,0x01,0x33,0x01,0x26,0x2d,0x20,0x01,0x33,0x01,0x26,0x2e,0x0b,0x01,0x33,0x01,
+0x34,0x2e,0x0f,0x01,0x33,0x01,0x26,0x2f,0x0a,0x01,0x33,0x01,0x05,0x30,0x01,0x01,
+0x05,0x01,0x06,0x30,0x19,0x01,0x55,0x01,0x40,0x30,0x20,0x01,0x55,0x01,0x4f,0x31,
+0x0f,0x02,0x55,0x01,0x05,0x32,0x11,0x01,0x55,0x01,0x16,0x32,0x01,0x0c,0x65,0x01,
+0x17,0x32,0x0e,0x08,0x55,0x01,0x04,0x33,0x0f,0x01,0x55,0x01,0x4f,0x33,0x07,0x01,
+0x55,0x01,0x01,0x34,0x01,0x02,0x05,0x01,0x04,0x34,0x0e,0x04,0x55,0x01,0x12,0x34,
+0x01,0x02,0x56,0x01,0x3f,0x34,0x0d,0x01,0x55,0x01,0x3f,0x35,0x0c,0x04,0x55,0x01,
+0x01,0x36,0x01,0x01,0x55,0x01,0x12,0x36,0x01,0x02,0x65,0x01,0x01,0x37,0x01,0x01,
+0x56,0x01,0x3f,0x39,0x0b,0x01,0x55,0x01,0x3c,0x3a,0x07,0x01,0x55,0x01,0x43,0x3a,
+0x07,0x01,0x66,0x01,0x43,0x3b,0x07,0x02,0x55,0x01,0x16,0x3e,0x01,0x01,0x66,0x01,
+0x16,0x3f,0x01,0x01,0x65,0x01,0x16,0x40,0x01,0x07,0x66,0x01,0x55,0x42,0x07,0x01,
+0x55,0x01,0x55,0x43,0x07,0x05,0x66,0x01,0x16,0x47,0x12,0x01,0x66,0x01,0x00,0x54,
+0x01,0x01,0x05,0x01,0x01,0x54,0x0c,0x01,0x55,0x01,0x4f,0x54,0x0f,0x0b,0x66,0x01,
+0x5e,0x54,0x01,0x01,0x65,0x01,0x02,0x55,0x0b,0x0a,0x66,0x01,0x5e,0x55,0x01,0x01,
+0x25,0x01,0x5e,0x56,0x01,0x02,0x75,0x01,0x28,0x57,0x0f,0x01,0x66,0x01,0x3c,0x57,
+0x11,0x01,0x66,0x01,0x3d,0x58,0x10,0x02,0x66,0x01,0x5e,0x58,0x01,0x07,0x65,0x01,
+0x3d,0x5a,0x01,0x01,0x56,0x01,0x3e,0x5a,0x0f,0x02,0x66,0x01,0x3d,0x5b,0x01,0x01,
+0x55,0x01,0x3d,0x5c,0x02,0x01,0x55,0x01,0x3f,0x5c,0x0e,0x01,0x66,0x01,0x40,0x5d,
+0x0d,0x01,0x66,0x01,0x43,0x5e,0x0a,0x01,0x66,0x01,0x02,0x5f,0x0e,0x01,0x55,0x01,
+0x15,0x5f,0x06,0x01,0x55,0x01,0x1b,0x5f,0x01,0x01,0x50,0x01,0x43,0x5f,0x1c,0x01,
+0x55,0x01,0x2b,0x68,0x0d,0x01,0x33,0x01,0x28,0x6a,0x01,0x01,0x06,0x01,0x43,0x6b,
+0x02,0x01,0x55,0x02,0x3e,0x02,0x02,0x03,0x04,0x40,0x44,0x40,0x44,0x40,0x02,0x3d,
+0x05,0x02,0x03,0x04,0x44,0x04,0x44,0x44,0x40,0x02,0x3c,0x08,0x02,0x05,0x04,0x44,
+0x04,0x44,0x04,0x40,0x44,0x40,0x44,0x00,0x02,0x27,0x0a,0x04,0x01,0x44,0x00,0x44,
+0x44,0x02,0x26,0x0b,0x06,0x05,0x04,0x44,0x44,0x44,0x44,0x40,0x04,0x44,0x44,0x44,
+0x44,0x40,0x44,0x44,0x41,0x11,0x44,0x44,0x44,0x44,0x11,0x11,0x64,0x40,0x44,0x42,
+0x22,0x22,0x64,0x40,0x02,0x3b,0x0d,0x02,0x04,0x04,0x44,0x04,0x40,0x44,0x40,0x44,
+0x00,0x02,0x25,0x10,0x06,0x04,0x44,0x44,0x22,0x34,0x44,0x64,0x44,0x42,0x12,0x22,
+0x34,0x44,0x44,0x41,0x22,0x33,0x44,0x40,0x44,0x22,0x33,0x34,0x40,0x00,0x02,0x38,
+0x11,0x04,0x04,0x04,0x40,0x00,0x44,0x44,0x40,0x04,0x40,0x44,0x44,0x44,0x40,0x44,
+0x44,0x44,0x00,0x02,0x24,0x14,0x05,0x01,0x44,0x44,0x23,0x44,0x44,0x02,0x30,0x14,
+0x02,0x01,0x44,0x40,0x02,0x24,0x15,0x17,0x01,0x44,0x42,0x34,0x44,0x44,0x40,0x00,
+0x00,0x00,0x00,0x00,0x04,0x44,0x40,0x00,0x00,0x00,0x00,0x04,0x44,0x43,0x44,0x44,
+0x02,0x23,0x16,0x1c,0x01,0x04,0x44,0x32,0x44,0x44,0x44,0x44,0x44,0x44,0x00,0x00,
+0x00,0x44,0x44,0x40,0x04,0x40,0x00,0x00,0x44,0x44,0x42,0x64,0x40,0x00,0x00,0x00,
+0x04,0x02,0x11,0x17,0x2e,0x01,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x44,0x55,
+0x55,0x55,0x55,0x55,0x50,0x05,0x50,0x04,0x44,0x44,0x36,0x64,0x44,0x44,0x44,0x44,
+0x44,0x45,0x56,0x44,0x44,0x44,0x44,0x44,0x44,0x65,0x64,0x44,0x44,0x23,0x54,0x40,
+0x00,0x05,0x54,0x44,0x02,0x25,0x18,0x1b,0x01,0x64,0x44,0x44,0x44,0x44,0x44,0x44,
+0x44,0x66,0x44,0x44,0x42,0x64,0x44,0x44,0x46,0x44,0x44,0x44,0x24,0x64,0x00,0x00,
+0x00,0x54,0x43,0x76,0x02,0x4d,0x18,0x04,0x01,0x67,0x66,0x66,0x55,0x02,0x11,0x19,
+0x40,0x0c,0x06,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x34,0x44,
+0x43,0x44,0x33,0x44,0x44,0x44,0x44,0x44,0x43,0x21,0x12,0x44,0x44,0x43,0x44,0x44,
+0x44,0x22,0x64,0x44,0x44,0x34,0x44,0x44,0x42,0x34,0x44,0x00,0x00,0x00,0x04,0x32,
+0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x37,0x73,0x77,0x77,
+0x77,0x60,0x00,0x44,0x32,0x22,0x23,0x23,0x42,0x22,0x44,0x44,0x32,0x22,0x22,0x22,
+0x22,0x22,0x22,0x44,0x44,0x44,0x44,0x21,0x11,0x11,0x11,0x44,0x44,0x33,0x44,0x44,
+0x44,0x12,0x54,0x44,0x42,0x44,0x44,0x44,0x31,0x34,0x44,0x00,0x00,0x00,0x44,0x11,
+0x22,0x32,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x23,0x32,0x33,0x22,0x33,0x33,
+0x76,0x50,0x00,0x54,0x42,0x22,0x21,0x12,0x42,0x22,0x34,0x44,0x22,0x22,0x22,0x22,
+0x22,0x22,0x23,0x44,0x44,0x44,0x31,0x11,0x11,0x12,0x23,0x54,0x44,0x24,0x44,0x44,
+0x42,0x14,0x44,0x44,0x42,0x44,0x44,0x44,0x12,0x44,0x40,0x00,0x00,0x00,0x42,0x12,
+0x22,0x22,0x22,0x22,0x22,0x23,0x32,0x22,0x22,0x22,0x23,0x32,0x32,0x22,0x22,0x33,
+0x65,0x00,0x00,0x04,0x42,0x11,0x12,0x22,0x34,0x22,0x34,0x44,0x22,0x22,0x22,0x22,
+0x22,0x22,0x24,0x44,0x44,0x41,0x11,0x11,0x22,0x22,0x35,0x64,0x44,0x24,0x44,0x44,
+0x31,0x24,0x44,0x44,0x24,0x44,0x44,0x43,0x13,0x44,0x40,0x00,0x00,0x04,0x31,0x22,
+0x22,0x22,0x22,0x22,0x22,0x23,0x32,0x22,0x22,0x22,0x37,0x33,0x32,0x22,0x22,0x37,
+0x60,0x00,0x00,0x05,0x44,0x21,0x22,0x22,0x24,0x32,0x23,0x44,0x32,0x22,0x22,0x22,
+0x22,0x22,0x24,0x44,0x42,0x11,0x11,0x22,0x22,0x22,0x44,0x44,0x41,0x24,0x44,0x44,
+0x21,0x44,0x44,0x44,0x34,0x44,0x44,0x42,0x24,0x44,0x40,0x00,0x00,0x04,0x11,0x22,
+0x22,0x23,0x22,0x22,0x22,0x22,0x23,0x22,0x22,0x22,0x32,0x22,0x22,0x22,0x23,0x36,
+0x50,0x00,0x00,0x00,0x44,0x32,0x22,0x22,0x13,0x42,0x23,0x44,0x42,0x22,0x22,0x22,
+0x22,0x22,0x34,0x44,0x41,0x11,0x22,0x22,0x32,0x22,0x64,0x44,0x21,0x44,0x44,0x43,
+0x13,0x44,0x44,0x43,0x64,0x44,0x44,0x42,0x44,0x44,0x40,0x00,0x00,0x42,0x12,0x22,
+0x22,0x23,0x63,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x32,0x23,0x22,0x22,0x33,0x76,
+0x00,0x00,0x00,0x00,0x04,0x42,0x22,0x22,0x22,0x43,0x22,0x44,0x43,0x22,0x22,0x22,
+0x22,0x22,0x44,0x44,0x21,0x12,0x22,0x22,0x22,0x24,0x44,0x43,0x11,0x44,0x44,0x42,
+0x26,0x44,0x44,0x44,0x44,0x34,0x44,0x44,0x44,0x44,0x00,0x00,0x04,0x41,0x12,0x22,
+0x22,0x27,0x56,0x32,0x22,0x22,0x22,0x22,0x22,0x23,0x22,0x32,0x22,0x22,0x37,0x65,
+0x00,0x00,0x00,0x00,0x05,0x43,0x22,0x22,0x22,0x34,0x22,0x34,0x44,0x22,0x22,0x22,
+0x22,0x22,0x44,0x44,0x22,0x22,0x22,0x22,0x22,0x44,0x44,0x31,0x12,0x44,0x44,0x42,
+0x44,0x44,0x44,0x44,0x42,0x24,0x44,0x44,0x42,0x64,0x00,0x00,0x04,0x11,0x22,0x22,
+0x22,0x27,0x67,0x22,0x22,0x22,0x22,0x22,0x22,0x23,0x22,0x72,0x22,0x22,0x36,0x50,
+0x00,0x00,0x00,0x00,0x00,0x44,0x36,0x32,0x22,0x24,0x22,0x24,0x44,0x32,0x22,0x22,
+0x22,0x23,0x44,0x43,0x12,0x22,0x22,0x22,0x24,0x44,0x44,0x11,0x22,0x44,0x44,0x44,
+0x44,0x24,0x44,0x44,0x31,0x13,0x44,0x43,0x21,0x64,0x00,0x00,0x42,0x12,0x22,0x22,
+0x22,0x23,0x33,0x22,0x22,0x22,0x22,0x22,0x22,0x32,0x23,0x22,0x12,0x23,0x76,0x00,
+0x00,0x00,0x00,0x00,0x00,0x54,0x43,0x22,0x22,0x23,0x42,0x23,0x44,0x32,0x22,0x22,
+0x22,0x24,0x44,0x42,0x22,0x22,0x22,0x22,0x44,0x44,0x41,0x12,0x22,0x44,0x44,0x44,
+0x42,0x14,0x44,0x44,0x11,0x11,0x22,0x21,0x12,0x64,0x40,0x04,0x31,0x12,0x22,0x22,
+0x22,0x22,0x33,0x22,0x22,0x22,0x22,0x32,0x23,0x32,0x23,0x22,0x22,0x33,0x65,0x00,
+0x00,0x00,0x00,0x00,0x00,0x06,0x43,0x22,0x22,0x22,0x43,0x23,0x44,0x43,0x22,0x22,
+0x22,0x24,0x44,0x42,0x22,0x22,0x22,0x24,0x44,0x44,0x11,0x22,0x22,0x24,0x44,0x44,
+0x21,0x11,0x44,0x41,0x12,0x21,0x11,0x11,0x12,0x44,0x40,0x44,0x11,0x22,0x22,0x22,
+0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x23,0x22,0x32,0x22,0x22,0x37,0x50,0x00,
+0x00,0x00,0x00,0x00,0x00,0x05,0x44,0x22,0x22,0x22,0x44,0x22,0x44,0x43,0x22,0x22,
+0x22,0x34,0x44,0x32,0x22,0x22,0x23,0x44,0x44,0x31,0x12,0x22,0x22,0x13,0x44,0x31,
+0x11,0x21,0x12,0x11,0x12,0x22,0x11,0x11,0x22,0x23,0x44,0x42,0x12,0x22,0x22,0x22,
+0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x33,0x22,0x32,0x22,0x33,0x76,0x50,0x00,
+0x00,0x00,0x02,0x15,0x25,0x38,0x06,0x54,0x32,0x22,0x22,0x34,0x32,0x34,0x44,0x32,
+0x22,0x22,0x44,0x44,0x22,0x22,0x23,0x44,0x44,0x42,0x11,0x22,0x22,0x22,0x21,0x21,
+0x11,0x22,0x22,0x11,0x12,0x22,0x22,0x22,0x22,0x22,0x11,0x11,0x11,0x12,0x22,0x22,
+0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x33,0x23,0x32,0x22,0x33,0x65,0x06,
+0x43,0x32,0x22,0x24,0x42,0x34,0x44,0x32,0x22,0x23,0x44,0x44,0x22,0x23,0x34,0x44,
+0x44,0x21,0x12,0x22,0x22,0x22,0x21,0x11,0x11,0x22,0x22,0x21,0x12,0x22,0x22,0x22,
+0x22,0x22,0x21,0x11,0x11,0x22,0x33,0x33,0x22,0x22,0x22,0x22,0x23,0x22,0x22,0x22,
+0x22,0x32,0x33,0x22,0x23,0x37,0x55,0x05,0x44,0x32,0x22,0x23,0x43,0x24,0x44,0x43,
+0x22,0x23,0x44,0x44,0x23,0x44,0x44,0x44,0x21,0x11,0x22,0x33,0x22,0x22,0x22,0x21,
+0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x33,0x22,0x22,0x21,0x22,0x23,0x63,0x32,
+0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x23,0x32,0x33,0x22,0x33,0x76,0x50,0x00,
+0x54,0x32,0x22,0x23,0x44,0x44,0x44,0x43,0x32,0x34,0x44,0x44,0x44,0x44,0x44,0x31,
+0x11,0x22,0x22,0x33,0x22,0x33,0x32,0x22,0x22,0x32,0x22,0x22,0x22,0x22,0x22,0x22,
+0x32,0x22,0x33,0x73,0x22,0x32,0x33,0x32,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+0x33,0x22,0x32,0x23,0x33,0x75,0x00,0x00,0x54,0x43,0x23,0x32,0x34,0x64,0x44,0x44,
+0x32,0x34,0x44,0x44,0x44,0x44,0x32,0x11,0x12,0x23,0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x32,0x32,0x23,0x23,0x32,0x33,0x33,0x33,0x33,0x22,0x33,0x23,0x33,0x23,0x32,
+0x22,0x22,0x22,0x22,0x22,0x23,0x22,0x33,0x33,0x23,0x32,0x33,0x37,0x65,0x00,0x00,
+0x05,0x44,0x22,0x32,0x34,0x43,0x44,0x44,0x43,0x44,0x44,0x22,0x22,0x21,0x11,0x12,
+0x23,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x32,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x32,0x32,0x33,0x32,0x22,0x23,0x32,0x22,0x22,0x22,0x33,
+0x33,0x33,0x33,0x33,0x76,0x50,0x00,0x02,0x17,0x2b,0x0f,0x05,0x64,0x33,0x33,0x23,
+0x43,0x34,0x44,0x43,0x44,0x44,0x21,0x11,0x11,0x12,0x23,0x54,0x43,0x33,0x33,0x44,
+0x34,0x44,0x44,0x44,0x44,0x22,0x22,0x22,0x23,0x33,0x55,0x44,0x33,0x33,0x44,0x34,
+0x44,0x44,0x44,0x42,0x23,0x33,0x33,0x33,0x33,0x05,0x44,0x44,0x43,0x44,0x44,0x44,
+0x44,0x34,0x32,0x34,0x43,0x34,0x33,0x33,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x56,
+0x22,0x26,0x55,0x55,0x55,0x64,0x44,0x02,0x38,0x2b,0x14,0x01,0x23,0x33,0x33,0x33,
+0x33,0x32,0x23,0x33,0x33,0x32,0x32,0x33,0x22,0x23,0x33,0x33,0x33,0x33,0x75,0x50,
+0x02,0x49,0x2c,0x02,0x01,0x37,0x65,0x02,0x46,0x2d,0x05,0x01,0x37,0x33,0x33,0x36,
+0x56,0x02,0x31,0x2e,0x03,0x01,0x34,0x33,0x43,0x02,0x43,0x2e,0x08,0x01,0x34,0x33,
+0x44,0x44,0x33,0x33,0x75,0x56,0x02,0x30,0x2f,0x1c,0x01,0x65,0x55,0x55,0x55,0x55,
+0x55,0x55,0x56,0x44,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x37,0x46,0x65,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x02,0x1f,0x30,0x21,0x01,0x62,0x75,0x55,0x55,
+0x55,0x55,0x54,0x44,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x77,0x55,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x54,0x43,0x33,0x33,0x33,0x33,0x33,0x76,0x02,0x04,0x31,
+0x4b,0x01,0x55,0x56,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x55,0x66,0x55,0x55,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x66,0x65,0x55,
+0x55,0x65,0x55,0x55,0x54,0x44,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x75,0x56,0x65,
+0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x43,0x33,0x33,0x33,0x33,0x76,0x55,0x55,0x55,
+0x66,0x66,0x56,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x66,0x55,0x56,0x02,0x5e,0x31,
+0x02,0x02,0x56,0x65,0x55,0x50,0x02,0x03,0x32,0x02,0x01,0x55,0x56,0x02,0x25,0x32,
+0x2a,0x02,0x65,0x55,0x44,0x43,0x33,0x33,0x33,0x33,0x33,0x37,0x65,0x56,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x54,0x43,0x33,0x33,0x33,0x77,0x55,0x55,0x66,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x56,0x56,0x55,0x54,0x44,
+0x33,0x33,0x33,0x33,0x33,0x77,0x55,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,
+0x43,0x33,0x33,0x37,0x75,0x55,0x66,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x55,0x55,0x55,0x65,0x55,0x56,0x02,0x02,0x33,0x02,0x05,0x55,0x56,0x55,0x65,0x56,
+0x55,0x65,0x56,0x66,0x56,0x02,0x13,0x33,0x03,0x05,0x65,0x55,0x55,0x55,0x56,0x55,
+0x55,0x46,0x55,0x54,0x46,0x55,0x54,0x45,0x55,0x02,0x56,0x33,0x0a,0x01,0x56,0x55,
+0x65,0x55,0x65,0x55,0x55,0x55,0x56,0x50,0x02,0x25,0x34,0x1a,0x06,0x55,0x66,0x55,
+0x44,0x43,0x33,0x33,0x33,0x33,0x75,0x55,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x54,0x43,0x33,0x33,0x76,0x55,0x56,0x55,0x56,0x55,0x54,0x43,0x33,0x33,0x33,0x37,
+0x75,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x43,0x33,0x37,0x65,0x55,
+0x55,0x55,0x55,0x65,0x54,0x44,0x33,0x33,0x33,0x37,0x55,0x56,0x55,0x55,0x55,0x55,
+0x55,0x55,0x55,0x55,0x54,0x43,0x33,0x77,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x44,
+0x33,0x33,0x33,0x77,0x55,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x43,
+0x37,0x75,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x44,0x43,0x33,0x33,0x75,0x56,0x65,
+0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x43,0x77,0x55,0x56,0x55,0x55,0x55,
+0x55,0x55,0x65,0x54,0x43,0x33,0x37,0x75,0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x55,0x65,0x54,0x43,0x76,0x55,0x65,0x55,0x55,0x02,0x4c,0x34,0x14,0x01,0x65,0x55,
+0x56,0x55,0x55,0x55,0x55,0x55,0x55,0x65,0x55,0x65,0x56,0x55,0x55,0x55,0x55,0x55,
+0x66,0x50,0x02,0x4b,0x35,0x14,0x04,0x56,0x55,0x55,0x56,0x55,0x55,0x55,0x55,0x55,
+0x55,0x55,0x66,0x56,0x65,0x66,0x66,0x66,0x65,0x55,0x65,0x66,0x55,0x55,0x56,0x55,
+0x55,0x55,0x55,0x55,0x65,0x56,0x66,0x66,0x66,0x66,0x66,0x65,0x65,0x56,0x65,0x65,
+0x55,0x55,0x56,0x55,0x55,0x55,0x55,0x55,0x56,0x65,0x66,0x66,0x66,0x66,0x66,0x65,
+0x56,0x66,0x50,0x65,0x56,0x65,0x56,0x55,0x55,0x55,0x55,0x65,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x65,0x66,0x50,0x02,0x00,0x38,0x16,0x10,0x05,0x56,0x66,0x66,
+0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x64,
+0x46,0x55,0x05,0x56,0x66,0x66,0x65,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x55,0x55,0x55,0x56,0x55,0x44,0x47,0x55,0x55,0x66,0x66,0x66,0x66,0x65,0x55,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x66,0x66,0x66,0x55,0x44,0x47,0x55,0x55,0x66,
+0x66,0x66,0x66,0x65,0x66,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x54,0x44,0x47,0x55,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x55,0x55,0x55,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x55,0x64,0x43,0x47,0x55,0x55,0x66,0x66,0x66,0x66,0x66,
+0x65,0x56,0x67,0x77,0x77,0x67,0x77,0x77,0x77,0x77,0x77,0x64,0x44,0x43,0x47,0x55,
+0x55,0x66,0x66,0x66,0x66,0x66,0x55,0x44,0x33,0x33,0x33,0x33,0x33,0x33,0x43,0x33,
+0x43,0x33,0x34,0x43,0x37,0x55,0x55,0x66,0x66,0x66,0x66,0x66,0x55,0x44,0x43,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x37,0x55,0x55,0x66,0x66,0x66,
+0x66,0x66,0x65,0x54,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x43,0x33,0x33,0x33,
+0x37,0x55,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x55,0x64,0x44,0x44,0x43,0x33,0x37,0x55,0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x65,
+0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x44,0x43,0x33,0x37,0x55,0x05,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x55,0x55,
+0x44,0x43,0x37,0x55,0x05,0x56,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x66,
+0x65,0x56,0x55,0x66,0x66,0x65,0x55,0x44,0x37,0x55,0x05,0x56,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x55,0x54,0x47,0x55,
+0x05,0x56,0x66,0x56,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x65,0x54,0x47,0x55,0x00,0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x55,0x47,0x55,0x02,0x4a,0x39,0x14,
+0x04,0x56,0x55,0x64,0x75,0x56,0x55,0x55,0x55,0x55,0x55,0x56,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x65,0x66,0x55,0x47,0x75,0x56,0x55,0x55,0x55,0x56,0x56,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x55,0x56,0x47,0x75,0x56,0x55,0x55,
+0x55,0x55,0x66,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x54,0x77,
+0x75,0x56,0x55,0x55,0x55,0x56,0x66,0x65,0x50,0x00,0x00,0x05,0x55,0x55,0x55,0x50,
+0x00,0x02,0x17,0x3a,0x25,0x01,0x55,0x55,0x55,0x55,0x56,0x66,0x66,0x66,0x66,0x66,
+0x66,0x65,0x55,0x55,0x55,0x55,0x55,0x65,0x54,0x43,0x33,0x37,0x55,0x66,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x55,0x65,0x54,0x47,0x75,0x56,0x02,0x17,0x3b,0x2c,0x02,
+0x55,0x55,0x55,0x55,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x66,0x65,0x55,0x55,0x55,
+0x55,0x66,0x54,0x43,0x33,0x77,0x55,0x65,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x65,0x54,0x47,0x75,0x56,0x55,0x55,0x55,0x55,0x55,0x56,0x66,0x55,0x56,0x56,0x56,
+0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x65,0x55,0x55,0x55,0x55,0x66,0x54,0x44,
+0x33,0x75,0x56,0x65,0x66,0x56,0x65,0x55,0x55,0x55,0x55,0x55,0x65,0x54,0x77,0x55,
+0x65,0x55,0x55,0x55,0x55,0x55,0x66,0x55,0x02,0x17,0x3d,0x3e,0x0a,0x55,0x66,0x66,
+0x66,0x65,0x55,0x66,0x77,0x66,0x66,0x55,0x55,0x56,0x66,0x55,0x56,0x55,0x66,0x55,
+0x44,0x37,0x65,0x56,0x56,0x66,0x66,0x66,0x66,0x66,0x55,0x55,0x55,0x65,0x54,0x67,
+0x55,0x65,0x55,0x55,0x55,0x55,0x56,0x65,0x55,0x56,0x66,0x55,0x56,0x56,0x66,0x66,
+0x57,0x43,0x77,0x75,0x56,0x55,0x55,0x56,0x66,0x66,0x65,0x56,0x66,0x66,0x66,0x65,
+0x55,0x44,0x33,0x44,0x44,0x66,0x55,0x56,0x66,0x66,0x66,0x66,0x66,0x55,0x44,0x77,
+0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x55,0x55,0x65,0x54,0x66,0x56,0x65,
+0x55,0x55,0x55,0x55,0x66,0x55,0x56,0x67,0x76,0x55,0x67,0x66,0x77,0x76,0x67,0x73,
+0x33,0x75,0x56,0x55,0x56,0x66,0x66,0x66,0x65,0x66,0x66,0x66,0x66,0x65,0x45,0x64,
+0x33,0x34,0x44,0x46,0x65,0x56,0x66,0x66,0x66,0x66,0x66,0x56,0x44,0x76,0x55,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x75,0x56,0x65,0x65,0x65,
+0x66,0x66,0x65,0x56,0x46,0x73,0x65,0x56,0x76,0x67,0x74,0x66,0x73,0x33,0x37,0x75,
+0x56,0x56,0x66,0x66,0x66,0x66,0x60,0x66,0x66,0x66,0x66,0x65,0x45,0x54,0x43,0x34,
+0x44,0x44,0x66,0x56,0x66,0x66,0x66,0x66,0x66,0x55,0x44,0x75,0x56,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x75,0x56,0x66,0x66,0x66,0x66,0x66,
+0x65,0x54,0x77,0x37,0x55,0x66,0x67,0x74,0x77,0x67,0x33,0x33,0x33,0x75,0x56,0x66,
+0x66,0x66,0x66,0x66,0x65,0x66,0x66,0x66,0x66,0x65,0x44,0x56,0x43,0x33,0x44,0x44,
+0x65,0x56,0x66,0x66,0x66,0x66,0x66,0x55,0x47,0x65,0x56,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x65,0x56,0x66,0x66,0x66,0x66,0x66,0x55,0x44,
+0x43,0x76,0x55,0x77,0x67,0x74,0x76,0x73,0x33,0x33,0x33,0x75,0x56,0x66,0x66,0x66,
+0x66,0x66,0x65,0x65,0x55,0x66,0x66,0x65,0x44,0x45,0x44,0x33,0x44,0x46,0x55,0x56,
+0x66,0x66,0x66,0x66,0x66,0x55,0x46,0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x65,0x54,0x65,0x66,0x66,0x66,0x66,0x66,0x66,0x55,0x47,0x33,0x75,
+0x56,0x77,0x74,0x77,0x67,0x33,0x33,0x33,0x33,0x75,0x56,0x66,0x66,0x66,0x66,0x66,
+0x55,0x66,0x55,0x66,0x66,0x65,0x64,0x65,0x64,0x44,0x44,0x65,0x55,0x66,0x66,0x66,
+0x66,0x66,0x66,0x55,0x65,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x66,0x66,0x66,0x66,
+0x66,0x65,0x56,0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x56,0x47,0x37,0x65,0x57,0x77,
+0x47,0x77,0x77,0x33,0x33,0x33,0x33,0x75,0x56,0x66,0x66,0x66,0x66,0x66,0x55,0x66,
+0x65,0x66,0x66,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x66,0x66,0x66,0x66,0x66,
+0x66,0x56,0x65,0x56,0x66,0x66,0x66,0x66,0x66,0x65,0x66,0x66,0x66,0x66,0x66,0x65,
+0x56,0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x54,0x43,0x36,0x65,0x74,0x74,0x37,0x76,
+0x73,0x33,0x33,0x33,0x33,0x75,0x56,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x65,0x66,0x66,0x66,0x66,0x55,0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x55,
+0x55,0x56,0x66,0x66,0x66,0x66,0x66,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x55,
+0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x33,0x36,0x56,0x74,0x43,0x33,0x67,0x33,0x33,
+0x33,0x33,0x33,0x77,0x56,0x66,0x66,0x66,0x66,0x65,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x55,0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x55,0x55,0x66,
+0x66,0x66,0x66,0x66,0x66,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x55,0x66,0x66,
+0x66,0x66,0x66,0x65,0x54,0x33,0x76,0x57,0x74,0x73,0x37,0x73,0x33,0x33,0x33,0x33,
+0x33,0x75,0x56,0x66,0x66,0x66,0x66,0x55,0x56,0x02,0x5c,0x42,0x02,0x06,0x66,0x50,
+0x66,0x50,0x66,0x50,0x66,0x50,0x66,0x50,0x66,0x50,0x02,0x28,0x47,0x2d,0x01,0x65,
+0x55,0x56,0x66,0x66,0x66,0x66,0x66,0x65,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x56,
+0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x43,0x65,0x67,0x44,0x33,0x76,0x33,0x33,
+0x33,0x33,0x33,0x33,0x75,0x56,0x66,0x66,0x66,0x66,0x55,0x56,0x02,0x01,0x48,0x5d,
+0x06,0x55,0x66,0x67,0x77,0x22,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,
+0x32,0x72,0x76,0x65,0x66,0x55,0x22,0x22,0x32,0x22,0x22,0x76,0x22,0x22,0x22,0x22,
+0x22,0x23,0x22,0x22,0x22,0x22,0x22,0x27,0x55,0x55,0x56,0x67,0x77,0x77,0x77,0x77,
+0x55,0x55,0x77,0x77,0x77,0x77,0x76,0x65,0x56,0x55,0x67,0x72,0x22,0x22,0x22,0x26,
+0x54,0x47,0x56,0x74,0x73,0x37,0x63,0x33,0x33,0x33,0x33,0x33,0x33,0x77,0x57,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x67,0x77,0x77,0x72,0x22,0x60,0x05,0x52,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x12,0x11,0x11,0x11,0x10,0x00,0x00,0x01,
+0x25,0x56,0x56,0x00,0x00,0x00,0x00,0x00,0x26,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x07,0x55,0x55,0x72,0x11,0x11,0x11,0x11,0x12,0x55,0x55,0x21,
+0x11,0x11,0x11,0x11,0x26,0x56,0x55,0x21,0x00,0x00,0x00,0x00,0x07,0x54,0x46,0x57,
+0x34,0x73,0x37,0x73,0x33,0x33,0x33,0x33,0x33,0x33,0x75,0x62,0x22,0x22,0x22,0x27,
+0x66,0x67,0x72,0x22,0x22,0x21,0x11,0x11,0x10,0x00,0x60,0x00,0x55,0x21,0x01,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x22,0x21,0x11,0x10,0x00,0x00,0x00,0x16,0x55,0x56,
+0x00,0x00,0x00,0x00,0x00,0x25,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x25,0x55,0x56,0x21,0x11,0x11,0x11,0x11,0x16,0x55,0x56,0x11,0x11,0x11,0x11,
+0x11,0x26,0x56,0x55,0x20,0x00,0x00,0x00,0x00,0x07,0x54,0x65,0x67,0x44,0x33,0x77,
+0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x75,0x61,0x22,0x22,0x22,0x22,0x37,0x72,0x22,
+0x22,0x22,0x21,0x11,0x11,0x00,0x00,0x60,0x00,0x05,0x57,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x22,0x22,0x32,0x21,0x11,0x00,0x00,0x00,0x12,0x55,0x56,0x00,0x00,0x00,
+0x00,0x00,0x25,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x55,0x55,
+0x52,0x21,0x11,0x11,0x11,0x11,0x25,0x56,0x55,0x11,0x11,0x11,0x11,0x11,0x16,0x56,
+0x55,0x20,0x00,0x00,0x00,0x00,0x02,0x56,0x55,0x77,0x77,0x74,0x63,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x75,0x62,0x22,0x22,0x22,0x22,0x23,0x22,0x22,0x22,0x22,0x21,
+0x11,0x11,0x10,0x00,0x60,0x00,0x00,0x55,0x56,0x22,0x21,0x11,0x12,0x22,0x22,0x22,
+0x36,0x63,0x21,0x11,0x11,0x00,0x00,0x12,0x55,0x56,0x00,0x00,0x00,0x00,0x00,0x25,
+0x55,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x75,0x55,0x55,0x62,0x11,0x11,
+0x11,0x11,0x11,0x65,0x66,0x56,0x11,0x11,0x11,0x11,0x11,0x16,0x56,0x55,0x20,0x00,
+0x00,0x00,0x00,0x12,0x55,0x56,0x74,0x47,0x76,0x73,0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x75,0x62,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x21,0x11,0x11,
+0x11,0x60,0x00,0x00,0x00,0x55,0x55,0x56,0x66,0x66,0x66,0x66,0x66,0x66,0x67,0x22,
+0x11,0x11,0x11,0x11,0x11,0x55,0x56,0x00,0x00,0x00,0x00,0x00,0x25,0x55,0x60,0x00,
+0x00,0x00,0x00,0x00,0x01,0x11,0x26,0x55,0x56,0x55,0x22,0x11,0x11,0x11,0x11,0x12,
+0x55,0x47,0x55,0x21,0x11,0x11,0x11,0x11,0x16,0x54,0x65,0x21,0x11,0x11,0x10,0x10,
+0x11,0x65,0x64,0x74,0x43,0x66,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x75,0x62,
+0x22,0x22,0x22,0x22,0x22,0x65,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x66,0x50,0x02,
+0x09,0x4e,0x4d,0x06,0x55,0x55,0x55,0x55,0x55,0x72,0x11,0x11,0x11,0x11,0x11,0x55,
+0x56,0x11,0x01,0x10,0x10,0x01,0x25,0x55,0x53,0x22,0x22,0x22,0x22,0x22,0x22,0x26,
+0x55,0x56,0x75,0x56,0x22,0x21,0x22,0x22,0x22,0x26,0x54,0x47,0x55,0x22,0x22,0x11,
+0x11,0x11,0x16,0x54,0x65,0x71,0x11,0x11,0x11,0x11,0x11,0x65,0x64,0x74,0x47,0x67,
+0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x75,0x62,0x22,0x22,0x22,0x22,0x22,0x65,
+0x50,0x00,0x00,0x00,0x00,0x55,0x52,0x22,0x22,0x11,0x11,0x11,0x65,0x56,0x11,0x11,
+0x11,0x11,0x11,0x25,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x56,0x44,0x75,
+0x53,0x22,0x22,0x22,0x22,0x22,0x75,0x54,0x37,0x55,0x22,0x22,0x22,0x22,0x11,0x16,
+0x54,0x75,0x61,0x11,0x11,0x11,0x11,0x12,0x25,0x54,0x44,0x46,0x73,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x75,0x62,0x22,0x22,0x22,0x22,0x32,0x65,0x00,0x00,0x00,
+0x00,0x00,0x05,0x56,0x22,0x22,0x22,0x22,0x11,0x65,0x56,0x11,0x11,0x11,0x11,0x11,
+0x25,0x60,0x00,0x00,0x00,0x00,0x05,0x56,0x66,0x56,0x64,0x47,0x65,0x67,0x22,0x22,
+0x22,0x22,0x22,0x55,0x44,0x37,0x55,0x22,0x22,0x22,0x22,0x22,0x26,0x54,0x75,0x52,
+0x11,0x11,0x22,0x11,0x12,0x26,0x56,0x47,0x66,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x75,0x62,0x22,0x22,0x23,0x33,0x32,0x60,0x00,0x00,0x00,0x00,0x00,0x05,
+0x56,0x22,0x22,0x22,0x22,0x22,0x65,0x56,0x22,0x22,0x22,0x22,0x22,0x25,0x00,0x00,
+0x00,0x00,0x00,0x00,0x56,0x43,0x44,0x44,0x66,0x55,0x77,0x22,0x22,0x22,0x22,0x26,
+0x55,0x44,0x37,0x55,0x22,0x22,0x22,0x22,0x22,0x26,0x54,0x75,0x52,0x22,0x22,0x22,
+0x22,0x22,0x27,0x55,0x64,0x64,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x75,
+0x62,0x22,0x27,0x33,0x77,0x72,0x60,0x00,0x00,0x00,0x00,0x00,0x05,0x56,0x32,0x22,
+0x22,0x22,0x22,0x55,0x56,0x22,0x22,0x22,0x22,0x22,0x25,0x00,0x00,0x00,0x00,0x00,
+0x00,0x56,0x43,0x44,0x46,0x65,0x56,0x67,0x73,0x22,0x22,0x22,0x25,0x54,0x44,0x37,
+0x55,0x22,0x22,0x22,0x22,0x22,0x26,0x54,0x76,0x56,0x22,0x22,0x22,0x22,0x22,0x27,
+0x65,0x55,0x64,0x43,0x33,0x33,0x33,0x34,0x43,0x47,0x43,0x37,0x75,0x62,0x77,0x77,
+0x77,0x77,0x73,0x65,0x00,0x00,0x00,0x00,0x00,0x55,0x66,0x77,0x33,0x32,0x22,0x22,
+0x55,0x56,0x22,0x22,0x22,0x22,0x22,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x44,
+0x44,0x46,0x55,0x56,0x66,0x77,0x77,0x37,0x33,0x65,0x55,0x66,0x65,0x55,0x23,0x33,
+0x33,0x22,0x22,0x26,0x54,0x77,0x55,0x22,0x22,0x22,0x22,0x22,0x27,0x66,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x62,0x77,0x76,0x77,0x66,0x67,
+0x65,0x50,0x02,0x0d,0x54,0x0f,0x0b,0x56,0x66,0x77,0x77,0x77,0x77,0x33,0x55,0x56,
+0x23,0x32,0x32,0x32,0x22,0x75,0x66,0x66,0x66,0x66,0x67,0x77,0x36,0x55,0x55,0x27,
+0x77,0x77,0x77,0x73,0x75,0x66,0x66,0x66,0x66,0x66,0x64,0x76,0x55,0x55,0x77,0x67,
+0x76,0x77,0x77,0x65,0x66,0x66,0x66,0x66,0x66,0x66,0x75,0x55,0x55,0x76,0x66,0x66,
+0x66,0x66,0x65,0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x56,0x55,0x76,0x66,0x66,0x66,
+0x66,0x65,0x66,0x66,0x66,0x66,0x66,0x66,0x50,0x00,0x55,0x66,0x66,0x66,0x66,0x66,
+0x65,0x66,0x66,0x66,0x66,0x66,0x65,0x50,0x00,0x55,0x66,0x66,0x66,0x66,0x66,0x65,
+0x66,0x66,0x66,0x66,0x66,0x55,0x00,0x00,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x66,
+0x66,0x66,0x66,0x65,0x50,0x00,0x00,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x66,0x66,
+0x66,0x65,0x55,0x00,0x00,0x00,0x55,0x66,0x66,0x66,0x66,0x66,0x65,0x66,0x66,0x55,
+0x55,0x00,0x00,0x00,0x00,0x55,0x66,0x66,0x66,0x66,0x66,0x55,0x02,0x23,0x54,0x2c,
+0x03,0x54,0x44,0x66,0x55,0x56,0x66,0x66,0x66,0x76,0x76,0x55,0x55,0x55,0x55,0x55,
+0x67,0x77,0x77,0x77,0x77,0x36,0x54,0x37,0x55,0x62,0x22,0x33,0x73,0x73,0x73,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x55,0x52,0x56,0x44,0x65,
+0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x67,0x46,0x77,0x77,
+0x77,0x35,0x54,0x37,0x75,0x57,0x77,0x77,0x77,0x77,0x77,0x76,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x67,0x65,0x57,0x05,0x44,0x65,0x55,0x56,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x67,0x75,0x54,0x47,
+0x75,0x56,0x77,0x76,0x76,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x65,0x57,0x02,0x00,0x55,0x02,0x0b,0x55,0x36,0x55,0x76,0x55,0x76,
+0x55,0x66,0x55,0x66,0x55,0x66,0x55,0x66,0x55,0x66,0x55,0x66,0x55,0x66,0x05,0x55,
+0x02,0x23,0x57,0x05,0x01,0x05,0x66,0x65,0x55,0x55,0x02,0x37,0x57,0x05,0x01,0x75,
+0x54,0x33,0x77,0x55,0x02,0x4d,0x57,0x02,0x08,0x65,0x57,0x65,0x56,0x65,0x56,0x65,
+0x56,0x65,0x56,0x65,0x56,0x65,0x56,0x55,0x56,0x02,0x24,0x58,0x19,0x05,0x56,0x55,
+0x55,0x56,0x66,0x66,0x66,0x66,0x56,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x65,0x54,0x33,0x37,0x65,0x56,0x05,0x55,0x55,0x56,0x66,0x66,0x66,0x65,0x55,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x43,0x37,0x75,0x55,
+0x05,0x55,0x56,0x66,0x66,0x66,0x66,0x65,0x55,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x65,0x54,0x33,0x37,0x77,0x55,0x55,0x55,0x55,0x66,0x66,0x66,0x66,
+0x55,0x55,0x56,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x43,0x33,
+0x77,0x65,0x55,0x55,0x56,0x66,0x66,0x66,0x65,0x55,0x65,0x56,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x33,0x33,0x76,0x55,0x02,0x23,0x5d,0x1d,0x01,
+0x05,0x55,0x55,0x55,0x56,0x66,0x66,0x65,0x56,0x76,0x55,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x65,0x54,0x33,0x37,0x46,0x56,0x75,0x55,0x55,0x02,0x23,0x5e,
+0x20,0x02,0x05,0x55,0x55,0x55,0x55,0x55,0x56,0x55,0x54,0x77,0x55,0x56,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x65,0x54,0x33,0x73,0x65,0x57,0x77,0x55,0x55,0x55,
+0x55,0x56,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x43,0x37,0x55,0x55,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x33,0x34,0x65,0x43,0x46,0x00,0x00,0x55,
+0x55,0x55,0x02,0x26,0x60,0x18,0x08,0x55,0x55,0x55,0x55,0x56,0x43,0x33,0x75,0x55,
+0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x64,0x37,0x34,0x56,0x44,0x70,0x05,
+0x67,0x66,0x66,0x33,0x33,0x33,0x33,0x37,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,
+0x73,0x33,0x33,0x75,0x67,0x74,0x00,0x00,0x54,0x44,0x44,0x43,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x65,0x63,0x44,0x00,0x00,
+0x06,0x44,0x44,0x43,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x37,0x56,0x44,0x40,0x00,0x00,0x05,0x44,0x44,0x43,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x46,0x54,0x34,0x00,0x00,0x00,
+0x00,0x64,0x44,0x44,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x33,0x65,0x67,0x47,0x00,0x00,0x00,0x00,0x56,0x44,0x44,0x33,0x33,0x33,0x33,
+0x33,0x33,0x33,0x23,0x33,0x33,0x33,0x33,0x33,0x34,0x65,0x73,0x40,0x00,0x00,0x00,
+0x00,0x06,0x44,0x44,0x43,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
+0x33,0x36,0x54,0x34,0x00,0x00,0x00,0x02,0x29,0x68,0x02,0x01,0x64,0x44,0x02,0x38,
+0x68,0x03,0x01,0x75,0x54,0x47,0x02,0x29,0x69,0x12,0x02,0x54,0x44,0x44,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x34,0x65,0x43,0x70,0x55,0x64,0x43,
+0x34,0x77,0x77,0x77,0x77,0x33,0x33,0x33,0x33,0x77,0x66,0x66,0x66,0x74,0x60,0x02,
+0x26,0x6b,0x17,0x01,0x05,0x55,0x55,0x55,0x64,0x44,0x76,0x55,0x55,0x55,0x55,0x67,
+0x33,0x33,0x76,0x65,0x55,0x55,0x56,0x76,0x66,0x55,0x55,0x02,0x1e,0x6c,0x28,0x02,
+0x55,0x55,0x55,0x55,0x50,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x56,0x46,0x65,0x55,
+0x55,0x55,0x55,0x56,0x33,0x33,0x65,0x55,0x55,0x55,0x55,0x66,0x76,0x55,0x55,0x55,
+0x55,0x50,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x05,
+0x55,0x55,0x55,0x55,0x56,0x64,0x65,0x55,0x55,0x55,0x55,0x56,0x73,0x77,0x55,0x55,
+0x55,0x55,0x55,0x66,0x75,0x55,0x55,0x55,0x55,0x50,0x00,0x05,0x55,0x55,0x55,0x55,
+0x02,0x1d,0x6e,0x2a,0x10,0x05,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x05,0x55,0x55,
+0x55,0x55,0x55,0x66,0x65,0x55,0x55,0x55,0x55,0x55,0x73,0x76,0x55,0x55,0x55,0x55,
+0x55,0x50,0x05,0x55,0x55,0x55,0x55,0x50,0x00,0x05,0x55,0x55,0x55,0x55,0x50,0x05,
+0x55,0x55,0x05,0x55,0x55,0x00,0x00,0x55,0x55,0x50,0x55,0x55,0x55,0x66,0x55,0x55,
+0x50,0x55,0x55,0x56,0x73,0x75,0x55,0x55,0x00,0x55,0x55,0x50,0x00,0x05,0x55,0x55,
+0x55,0x00,0x00,0x55,0x55,0x00,0x55,0x55,0x50,0x05,0x55,0x50,0x00,0x55,0x55,0x00,
+0x00,0x55,0x55,0x00,0x05,0x55,0x56,0x56,0x55,0x55,0x50,0x05,0x55,0x56,0x43,0x75,
+0x55,0x50,0x00,0x55,0x55,0x50,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,
+0x55,0x55,0x00,0x05,0x55,0x50,0x00,0x55,0x55,0x00,0x00,0x55,0x55,0x00,0x05,0x55,
+0x56,0x56,0x55,0x55,0x00,0x05,0x55,0x56,0x77,0x75,0x55,0x50,0x00,0x55,0x55,0x00,
+0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x55,0x55,0x00,0x05,0x55,0x50,
+0x00,0x55,0x55,0x00,0x00,0x55,0x55,0x00,0x55,0x55,0x57,0x66,0x55,0x55,0x00,0x05,
+0x55,0x56,0x73,0x75,0x55,0x50,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x00,
+0x00,0x55,0x55,0x00,0x55,0x55,0x00,0x05,0x55,0x50,0x05,0x55,0x50,0x00,0x05,0x55,
+0x55,0x00,0x55,0x55,0x57,0x76,0x55,0x55,0x00,0x05,0x55,0x57,0x74,0x65,0x55,0x50,
+0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,
+0x00,0x05,0x55,0x00,0x05,0x55,0x50,0x00,0x05,0x55,0x50,0x00,0x55,0x55,0x50,0x76,
+0x55,0x55,0x00,0x05,0x55,0x57,0x34,0x65,0x55,0x50,0x00,0x55,0x55,0x00,0x00,0x00,
+0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x00,0x05,0x55,0x00,0x05,0x55,
+0x50,0x00,0x05,0x55,0x50,0x00,0x55,0x55,0x00,0x06,0x55,0x55,0x00,0x55,0x55,0x57,
+0x37,0x55,0x55,0x50,0x00,0x55,0x55,0x00,0x00,0x05,0x55,0x55,0x00,0x00,0x00,0x55,
+0x55,0x00,0x00,0x00,0x00,0x05,0x55,0x00,0x05,0x55,0x50,0x00,0x05,0x55,0x50,0x00,
+0x55,0x55,0x00,0x05,0x55,0x55,0x00,0x55,0x55,0x64,0x37,0x55,0x55,0x50,0x05,0x55,
+0x50,0x00,0x00,0x05,0x55,0x50,0x00,0x00,0x00,0x55,0x55,0x50,0x00,0x00,0x00,0x55,
+0x55,0x00,0x05,0x55,0x50,0x00,0x05,0x55,0x50,0x00,0x55,0x55,0x00,0x00,0x55,0x55,
+0x55,0x55,0x55,0x63,0x37,0x55,0x55,0x50,0x05,0x55,0x50,0x00,0x00,0x05,0x55,0x50,
+0x00,0x00,0x00,0x55,0x55,0x50,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x50,0x00,
+0x05,0x55,0x50,0x05,0x55,0x55,0x00,0x00,0x55,0x55,0x55,0x55,0x56,0x73,0x36,0x55,
+0x55,0x00,0x05,0x55,0x50,0x00,0x00,0x05,0x55,0x50,0x00,0x00,0x00,0x05,0x55,0x55,
+0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x05,0x55,0x50,0x05,0x55,0x50,
+0x00,0x05,0x55,0x55,0x55,0x55,0x57,0x43,0x76,0x55,0x55,0x00,0x05,0x55,0x50,0x00,
+0x00,0x05,0x55,0x50,0x00,0x00,0x00,0x00,0x55,0x55,0x50,0x00,0x00,0x55,0x55,0x55,
+0x55,0x50,0x00,0x00,0x05,0x55,0x00,0x05,0x55,0x50,0x00,0x05,0x55,0x55,0x55,0x55,
+0x55,0x73,0x76,0x55,0x55,0x00,0x05,0x55,0x50,0x00,0x00,0x05,0x55,0x50,0x00,0x00,
+0x00,0x00,0x05,0x55,0x55,0x00,0x00,0x55,0x55,0x55,0x55,0x50,0x00,0x00,0x05,0x55,
+0x00,0x05,0x55,0x50,0x00,0x05,0x55,0x50,0x05,0x55,0x55,0x73,0x76,0x55,0x55,0x00,
+0x05,0x55,0x50,0x00,0x00,0x05,0x55,0x50,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x00,
+0x00,0x55,0x55,0x55,0x55,0x50,0x00,0x00,0x55,0x55,0x00,0x05,0x55,0x50,0x00,0x05,
+0x55,0x50,0x05,0x55,0x55,0x73,0x75,0x55,0x55,0x00,0x05,0x55,0x50,0x00,0x00,0x05,
+0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x55,0x50,0x05,0x55,0x50,
+0x00,0x00,0x55,0x55,0x00,0x05,0x55,0x50,0x00,0x05,0x55,0x50,0x05,0x55,0x55,0x74,
+0x65,0x55,0x55,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x00,0x00,
+0x00,0x55,0x55,0x00,0x00,0x02,0x1c,0x7e,0x29,0x09,0x05,0x55,0x50,0x05,0x55,0x50,
+0x00,0x00,0x55,0x55,0x00,0x05,0x55,0x50,0x00,0x05,0x55,0x50,0x05,0x55,0x56,0x77,
+0x55,0x55,0x50,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x00,0x00,
+0x00,0x05,0x55,0x05,0x55,0x50,0x05,0x55,0x50,0x00,0x00,0x55,0x55,0x00,0x05,0x55,
+0x50,0x00,0x05,0x55,0x00,0x05,0x55,0x56,0x66,0x55,0x55,0x50,0x00,0x55,0x55,0x00,
+0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x05,0x50,0x00,0x55,0x55,0x05,0x55,0x50,0x05,
+0x55,0x50,0x00,0x00,0x55,0x55,0x00,0x55,0x55,0x00,0x00,0x05,0x55,0x00,0x05,0x55,
+0x56,0x65,0x55,0x55,0x50,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,
+0x55,0x55,0x00,0x55,0x55,0x05,0x55,0x50,0x05,0x55,0x50,0x00,0x00,0x55,0x55,0x00,
+0x55,0x55,0x00,0x00,0x55,0x55,0x00,0x05,0x55,0x55,0x56,0x55,0x55,0x50,0x00,0x55,
+0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x00,0x55,0x55,0x05,0x55,
+0x50,0x05,0x55,0x50,0x00,0x05,0x55,0x55,0x00,0x55,0x55,0x00,0x00,0x55,0x55,0x00,
+0x55,0x55,0x55,0x56,0x55,0x55,0x50,0x00,0x55,0x55,0x00,0x00,0x00,0x55,0x50,0x00,
+0x00,0x05,0x55,0x55,0x00,0x55,0x55,0x05,0x55,0x00,0x05,0x55,0x55,0x00,0x05,0x55,
+0x55,0x05,0x55,0x55,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x55,0x55,0x50,
+0x05,0x55,0x50,0x00,0x00,0x00,0x55,0x50,0x00,0x00,0x05,0x55,0x55,0x65,0x55,0x55,
+0x55,0x55,0x00,0x05,0x55,0x55,0x00,0x05,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x55,
+0x55,0x55,0x55,0x55,0x50,0x00,0x05,0x55,0x55,0x55,0x55,0x50,0x00,0x00,0x05,0x55,
+0x50,0x00,0x00,0x05,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x00,0x05,0x55,0x55,0x00,
+0x00,0x55,0x55,0x55,0x55,0x50,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x05,
+0x55,0x55,0x55,0x55,0x50,0x00,0x00,0x05,0x55,0x50,0x00,0x00,0x00,0x55,0x55,0x55,
+0x55,0x50,0x05,0x55,0x00,0x00,0x55,0x55,0x00,0x00,0x05,0x55,0x55,0x55,0x00,0x00,
+0x00,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x50,0x00,0x00,0x00,
+0x05,0x55,0x50,0x00,0x00,0x00,0x05,0x55,0x55,0x50,0x00,0x02,0x25,0x87,0x02,0x01,
+0x05,0x55,0x02,0x34,0x87,0x02,0x01,0x55,0x50,0x02,0x41,0x87,0x02,0x01,0x05,0x55,
+0x00,
+};
+
+#endif
+
+#ifdef USE_CPU_DECODER
+
 // http://paulbourke.net/dataformats/tga/
 typedef struct {
    char  idlength;
@@ -142,6 +612,109 @@ void draw_tga(const byte* tgadata, byte cenx, byte ceny) {
   }
 }
 
+#else
+
+// blitter stream opcodes (see tools/williams/tga2blit.py)
+#define OP_END 0
+#define OP_FILL 1
+#define OP_COPY 2
+
+// play back a stream of blitter ops (see tools/williams/tga2blit.py)
+// origin = byte column in low byte, scanline in high byte
+void blit_ops(const byte* ops, word origin) __naked {
+  ops; origin;
+__asm
+        ld      hl,#2
+        add     hl,sp
+        ld      e,(hl)
+        inc     hl
+        ld      d,(hl)          ; de = ops
+        inc     hl
+        ld      c,(hl)          ; c = x origin
+        inc     hl
+        ld      b,(hl)          ; b = y origin
+        ex      de,hl
+00001$:
+        ld      a,(hl)          ; opcode
+        or      a
+        ret     z               ; OP_END
+        inc     hl
+        push    af
+        ld      a,(hl)          ; x
+        add     a,c
+        ld      (_blitter+4),a  ; dstart is byte-swapped
+        inc     hl
+        ld      a,(hl)          ; y
+        add     a,b
+        ld      (_blitter+5),a
+        inc     hl
+        ld      e,(hl)          ; width
+        ld      a,e
+        xor     #4
+        ld      (_blitter+6),a
+        inc     hl
+        ld      d,(hl)          ; height
+        ld      a,d
+        xor     #4
+        ld      (_blitter+7),a
+        inc     hl
+        pop     af
+        dec     a
+        jr      nz,00002$
+; OP_FILL: color
+        ld      a,(hl)
+        inc     hl
+        ld      (_blitter+1),a
+        ld      a,#(DSTSCREEN|SOLID)
+        ld      (_blitter),a
+        jr      00004$
+; OP_COPY: w*h bytes of data
+00002$:
+        ld      a,h             ; sstart is byte-swapped too
+        ld      (_blitter+2),a
+        ld      a,l
+        ld      (_blitter+3),a
+        ld      a,#DSTSCREEN
+        ld      (_blitter),a
+        push    bc
+        push    hl
+        ld      a,d
+        ld      d,#0
+        ld      h,d
+        ld      l,d
+        ld      b,#8
+00003$:
+        add     hl,hl           ; hl = width * height
+        rla
+        jr      nc,00005$
+        add     hl,de
+00005$:
+        djnz    00003$
+        pop     de
+        add     hl,de           ; skip over data
+        pop     bc
+00004$:
+        ld      a,#0x39
+        ld      (_watchdog0x39),a ; watchdog reset
+        jr      00001$
+__endasm;
+}
+
+// draw an image made of solid fills and ROM copies,
+// centered at byte column cenx and scanline ceny
+void draw_blit_rle(const byte* src, byte cenx, byte ceny) {
+  byte x0 = cenx - src[0]/2;
+  byte y0 = ceny - src[1]/2;
+  byte i;
+  // set palette
+  for (i=0; i<src[2]; i++) {
+    palette[i] = src[3+i];
+  }
+  blit_ops(src+3+i, x0 | (y0 << 8));
+}
+
+#endif
+
 void clrscr() {
   word i = sizeof(vidmem)-1;
   do {
@@ -152,7 +725,11 @@ void clrscr() {
 
 void main() {
   clrscr();
+#ifdef USE_CPU_DECODER
   draw_tga(example_tga, 152/2, 256/2);
+#else
+  draw_blit_rle(example_blit, 152/2, 256/2);
+#endif
   while (1) {
     watchdog0x39 = 0x39;
   }
@@ -60,6 +60,9 @@ struct {
 
 #define WATCHDOG watchdog0x39=0x39;
 
+// uncomment to measure collision tests per frame at startup
+//#define BENCHMARK_COLLISIONS
+
 //
 
 void main();
@@ -531,6 +534,57 @@ const byte* const all_sprites[9] = {
   sprite9,
 };
 
+// per-row occupancy masks, leftmost pixel in bit 15
+// (generated by tools/williams/shapemasks.py)
+const word laser_vert_mask[8] = {
+  0xc000,0xc000,0xc000,0xc000,0xc000,0xc000,0xc000,0xc000
+};
+const word laser_horiz_mask[2] = {
+  0xff00,0xff00
+};
+const word playersprite1_mask[16] = {
+  0x0f80,0x3fe0,0x7ff0,0x7ff0,0x7ff0,0x3fe0,0x3fe0,0x0f80,0xfff8,0x7ff0,0x6fb0,0x6fb0,0x6fb0,0x4d90,0x0d80,0x1dc0
+};
+const word sprite1_mask[16] = {
+  0x1c38,0x3e7c,0x7e7e,0xfe7f,0xffff,0x7ffe,0x3ffc,0x1ff8,0x23c4,0x1ff8,0x1ff8,0x17e8,0x63c6,0x2424,0x0240,0x1c38
+};
+const word sprite2_mask[16] = {
+  0x3e7c,0x7e7e,0xfe7f,0xffff,0x7ffe,0x3ffc,0x1ff8,0x23c4,0x1ff8,0x1ff8,0x17e8,0x63c6,0x2424,0x0240,0x0200,0x0000
+};
+const word sprite3_mask[16] = {
+  0x0180,0x03c0,0x0180,0x0180,0x399c,0xcbd3,0x8ff1,0x83c1,0x1bd8,0x2ff4,0x43c2,0x4662,0x4812,0x2424,0x2004,0x1818
+};
+const word sprite4_mask[16] = {
+  0x0000,0x03c0,0x03c0,0x0ff0,0x1ff8,0x1ff8,0x3ffc,0x3ffc,0x1ff8,0x0ff0,0xc7e3,0xa7e5,0x87e1,0x47e2,0x2664,0x5a5a
+};
+const word sprite5_mask[16] = {
+  0x0000,0x0c30,0x2814,0x7c3e,0x1c38,0x07e0,0x07e0,0x0ff0,0x0ff0,0x4ff2,0x9ff9,0x7ffe,0x7ffe,0x8ff1,0x9a59,0x524a
+};
+const word sprite6_mask[12] = {
+  0x0054,0x00fe,0x05ff,0x0ffe,0x1ffe,0x3ffc,0x7ff0,0x73e0,0x6100,0x4000,0x0000,0x0000
+};
+const word sprite7_mask[16] = {
+  0x2004,0xa005,0xa815,0xa425,0xe5a7,0xeff7,0xeff7,0x7ffe,0x3ffc,0x3ffc,0x7ffe,0x25a4,0x2c34,0x0810,0x0000,0x0000
+};
+const word sprite8_mask[16] = {
+  0x0ff0,0x1ff8,0x3ffc,0x3ffc,0x3ffc,0x3ffc,0x3ffc,0x1ff8,0x1ff8,0x37ec,0x17e8,0x6666,0xcc33,0x8661,0x0240,0x0000
+};
+const word sprite9_mask[13] = {
+  0x0c30,0x0990,0x7ffe,0x1ff8,0x1ff8,0x1ff8,0x3ffc,0x7ffe,0x3e7c,0x1a58,0x381c,0x381c,0x1818
+};
+
+const word* const all_masks[9] = {
+  sprite1_mask,
+  sprite2_mask,
+  sprite3_mask,
+  sprite4_mask,
+  sprite5_mask,
+  sprite6_mask,
+  sprite7_mask,
+  sprite8_mask,
+  sprite9_mask,
+};
+
 // GAME CODE
 
 typedef struct Actor;
@@ -541,10 +595,17 @@ typedef void (*ActorDrawFn)(struct Actor* a);
 typedef struct Actor {
   struct Actor* next;
   struct Actor** prevptr;
+  struct Actor* cell_next; // collision grid links
+  struct Actor** cell_prevptr;
   byte x,y;
   byte* shape;
+  const word* mask;
   ActorUpdateFn update;
   ActorDrawFn draw;
+  byte band; // screen band we're bucketed in
+  byte tick_mask; // update when (frame & tick_mask) == tick_phase
+  byte tick_phase;
+  byte cell; // collision grid cell
   union {
     struct { sbyte dx,dy; } laser;
     struct { byte exploding; } enemy;
@@ -553,11 +614,30 @@ typedef struct Actor {
 
 #define MAX_ACTORS 128
 
+// the screen is split into horizontal bands, and each actor
+// lives in the bucket of the band containing its top edge
+#define BAND_SHIFT 5
+#define NBANDS (256 >> BAND_SHIFT)
+#define BAND_OF(y) ((byte)(y) >> BAND_SHIFT)
+// lines below the top of a band that its blits may touch
+// (band height + tallest sprite + fastest move per frame)
+#define BAND_SPAN ((1 << BAND_SHIFT) + 16 + 8)
+
 static Actor actors[MAX_ACTORS];
-static Actor* player_list;
-static Actor* fast_list;
-static Actor* slow_lists[4];
+static Actor* band_lists[NBANDS];
+static Actor* migrate_list; // actors that changed band this frame
 static Actor* obstacle_list;
+
+// enemies are also bucketed into a grid of 32x32 cells
+// by their top-left corner, for collision tests
+// (the rows are the bands)
+#define CELL_SHIFT 5
+#define GRID_SIZE (256 >> CELL_SHIFT)
+#define GRID_ROW_SHIFT (8 - CELL_SHIFT) // GRID_SIZE == 1 << GRID_ROW_SHIFT
+#define GRID_CELL(row,col) (((row) << GRID_ROW_SHIFT) | (col))
+#define CELL_OF(x,y) GRID_CELL(BAND_OF(y), (byte)(x) >> CELL_SHIFT)
+
+static Actor* grid[NBANDS*GRID_SIZE];
 static Actor* free_list;
 static Actor* effects_list;
 static byte frame;
@@ -579,8 +659,81 @@ void remove_actor(Actor* a) {
   *a->prevptr = a->next;
 }
 
+// BLITTER COMMAND QUEUE
+
+// same layout as the blitter registers
+typedef struct BlitCmd {
+  byte flags;
+  byte solid;
+  word sstart;
+  word dstart;
+  byte width;
+  byte height;
+} BlitCmd;
+
+#define MAX_BLITS 32
+
+static BlitCmd blit_queue[MAX_BLITS];
+static byte blit_count;
+
+// per-band statistics (inspect in the debugger)
+static byte band_overruns[NBANDS]; // beam caught up with our blits
+static byte band_max_blits[NBANDS]; // most blits queued at once
+static byte queue_overflows; // queue filled up before the beam passed
+
+void flush_blits() {
+  BlitCmd* c = blit_queue;
+  while (blit_count) {
+    blitter.solid = c->solid;
+    blitter.sstart = c->sstart;
+    blitter.dstart = c->dstart;
+    blitter.width = c->width;
+    blitter.height = c->height;
+    blitter.flags = c->flags; // starts the blit
+    c++;
+    blit_count--;
+  }
+}
+
+void queue_sprite(const byte* data, byte x, byte y, byte flags, byte color) {
+  BlitCmd* c;
+  if (blit_count == MAX_BLITS) {
+    // no room, so draw now and risk tearing
+    queue_overflows++;
+    flush_blits();
+  }
+  c = &blit_queue[blit_count++];
+  c->width = data[0]^4;
+  c->height = data[1]^4;
+  c->sstart = swapw((word)(data+2));
+  c->dstart = (x>>1)+y*256+XBIAS; // swapped
+  c->solid = color;
+  c->flags = (x&1) ? flags|RSHIFT : flags;
+}
+
+void grid_add(Actor* a) {
+  Actor** cell = &grid[a->cell = CELL_OF(a->x, a->y)];
+  if (*cell) (*cell)->cell_prevptr = &a->cell_next;
+  a->cell_next = *cell;
+  a->cell_prevptr = cell;
+  *cell = a;
+}
+
+void grid_remove(Actor* a) {
+  if (a->cell_next) a->cell_next->cell_prevptr = a->cell_prevptr;
+  *a->cell_prevptr = a->cell_next;
+  a->cell_prevptr = NULL;
+}
+
+void grid_move(Actor* a) {
+  if (CELL_OF(a->x, a->y) != a->cell) {
+    grid_remove(a);
+    grid_add(a);
+  }
+}
+
 void draw_actor_normal(Actor* a) {
-  draw_sprite(a->shape, a->x, a->y);
+  queue_sprite(a->shape, a->x, a->y, DSTSCREEN|FGONLY, 0);
 }
 
 void draw_actor_exploding(Actor* a) {
@@ -596,24 +749,23 @@ void update_actor(Actor* a) {
   // if NULL shape, we don't have anything
   if (a->shape) {
     // erase the sprite
-    draw_sprite_solid(a->shape, a->x, a->y, 0);
+    queue_sprite(a->shape, a->x, a->y, DSTSCREEN|FGONLY|SOLID, 0);
     // call update callback
     if (a->update) {
       a->update(a);
     }
-    // did we delete it?
-    if (a->shape) {
-      // draw the sprite
-      if (a->draw) {
-        a->draw(a);
-      }
-    } else {
-      // shape became null, remove from list
-      remove_actor(a);
+    // did we delete it? if not, draw the sprite
+    if (a->shape && a->draw) {
+      a->draw(a);
     }
   }
 }
 
+void add_actor_to_band(Actor* a) {
+  a->band = BAND_OF(a->y);
+  add_actor(&band_lists[a->band], a);
+}
+
 //
 
 word lfsr = 1;
@@ -653,61 +805,36 @@ signed char random_dir() {
   else return 1;
 }
 
-void update_actor_list(Actor* a) {
-  while (a) {
-    update_actor(a);
-    a = a->next;
-  }
-}
-
-static byte g_section;
-
-void update_actors_partial(Actor* a) {
-  while (a) {
-    if (g_section ^ (a->y < 0x80)) {
-      update_actor(a);
-    }
-    a = a->next;
-  }
-}
-
-void update_screen_section(byte section) {
-  g_section = section;
-  update_actors_partial(player_list);
-  update_actors_partial(fast_list);
-  update_actors_partial(slow_lists[frame & 3]);
-}
-
 static Actor* test_actor;
 static byte test_x, test_y;
 
-byte minbyte(byte a, byte b) { return a<b?a:b; }
-byte maxbyte(byte a, byte b) { return a>b?a:b; }
-
+// AND the occupancy masks of each overlapping row
 bool test_actor_pixels(Actor* a) {
-  if (a->shape) {
-    byte x,y;
-    byte *p1, *p2;
-    byte x1 = maxbyte(test_actor->x, a->x);
-    byte y1 = maxbyte(test_actor->y, a->y);
-    byte x2 = minbyte(test_actor->x + test_actor->shape[0]*2,
-                      a->x + a->shape[0]*2);
-    byte y2 = minbyte(test_actor->y + test_actor->shape[1],
-                      a->y + a->shape[1]);
-    if (x2 < x1) x2 = 255; // clip to 8-bit coord.
-    if (y2 < y1) y2 = 255; // clip to 8-bit coord.
-    if (x2 <= x1 || y2 <= y1) return false;
-    //draw_box(x1,y1,x2,y2,0xff);
-    p1 = &test_actor->shape[2+(y1-test_actor->y)*test_actor->shape[0]];
-    p2 = &a->shape[2+(y1-a->y)*a->shape[0]];
-    p1 += (x1 - test_actor->x) >> 1;
-    p2 += (x1 - a->x) >> 1;
-    for (y=y1; y<y2; y++) {
-      for (x=x1; x<x2; x++) {
-        if (p1[x] && p2[x]) return true;
-      }
-      p1 += test_actor->shape[0];
-      p2 += a->shape[0];
+  const word* m1 = test_actor->mask;
+  const word* m2 = a->mask;
+  sbyte dx = a->x - test_x;
+  sbyte dy = a->y - test_y;
+  sbyte n;
+  // masks are 16 pixels wide
+  if ((byte)(dx + 15) >= 31) return false;
+  // count rows where both shapes overlap
+  if (dy >= 0) {
+    m1 += dy;
+    n = test_actor->shape[1] - dy;
+    if (n > a->shape[1]) n = a->shape[1];
+  } else {
+    m2 -= dy;
+    n = a->shape[1] + dy;
+    if (n > test_actor->shape[1]) n = test_actor->shape[1];
+  }
+  if (dx >= 0) {
+    while (n-- > 0) {
+      if (*m1++ & (*m2++ >> dx)) return true;
+    }
+  } else {
+    dx = -dx;
+    while (n-- > 0) {
+      if (*m1++ & (*m2++ << dx)) return true;
     }
   }
   return false;
@@ -719,12 +846,12 @@ inline bool test_collision_actor(Actor* a) {
           test_actor_pixels(a));
 }
 
-Actor* test_collisions(Actor* a) {
+Actor* test_cell_collisions(Actor* a) {
   while (a) {
     if (test_collision_actor(a)) {
       return a;
     }
-    a = a->next;
+    a = a->cell_next;
   }
   return NULL;
 }
@@ -735,6 +862,25 @@ void setup_collision(Actor* a) {
   test_y = a->y;
 }
 
+// test enemies whose top-left corner is within 16 pixels,
+// which is at most 2x2 grid cells
+Actor* test_grid_collisions() {
+  Actor* a;
+  byte row = BAND_OF(test_y - 15);
+  byte col = (byte)(test_x - 15) >> CELL_SHIFT;
+  byte row2 = BAND_OF(test_y + 16);
+  byte col2 = (byte)(test_x + 16) >> CELL_SHIFT;
+  while (1) {
+    a = test_cell_collisions(grid[GRID_CELL(row, col)]);
+    if (!a && col != col2)
+      a = test_cell_collisions(grid[GRID_CELL(row, col2)]);
+    if (a) return a;
+    if (row == row2) break;
+    row = (row+1) & (NBANDS-1);
+  }
+  return NULL;
+}
+
 void destroy_player() {
   Actor* a = &actors[PLAYER];
   byte i;
@@ -757,6 +903,7 @@ void destroy_player() {
 void random_walk(Actor* a) {
   a->x += random_dir();
   a->y += random_dir();
+  grid_move(a);
   setup_collision(a);
   if (actors[PLAYER].shape && test_collision_actor(&actors[PLAYER])) {
     destroy_player();
@@ -768,11 +915,7 @@ void laser_move(Actor* a) {
   // did we hit something?
   static Actor* collided;
   setup_collision(a);
-  collided = test_collisions(fast_list);
-  if (!collided) collided = test_collisions(slow_lists[0]);
-  if (!collided) collided = test_collisions(slow_lists[1]);
-  if (!collided) collided = test_collisions(slow_lists[2]);
-  if (!collided) collided = test_collisions(slow_lists[3]);
+  collided = test_grid_collisions();
   if (collided) {
     // get rid of laser (we can do this in our 'update' fn)
     a->shape = NULL;
@@ -782,6 +925,7 @@ void laser_move(Actor* a) {
     collided->u.enemy.exploding = 1;
     // move enemy to effects list
     remove_actor(collided);
+    grid_remove(collided);
     add_actor(&effects_list, collided);
     // play sound
     sound_pia = 2;
@@ -798,23 +942,24 @@ void laser_move(Actor* a) {
   if (a->y > 255-8) a->shape = NULL;
 }
 
-void shoot_laser(sbyte dx, sbyte dy, const byte* shape) {
+void shoot_laser(sbyte dx, sbyte dy, const byte* shape, const word* mask) {
   Actor* a = &actors[LASER];
   a->shape = (void*) shape;
+  a->mask = mask;
   a->x = actors[PLAYER].x + 6;
   a->y = actors[PLAYER].y + 8;
   a->u.laser.dx = dx;
   a->u.laser.dy = dy;
-  add_actor(&player_list, a);
+  add_actor_to_band(a);
 }
 
 void player_laser() {
   // is the laser being used?
   if (actors[LASER].shape == NULL) { // no, check controls
-    if (UP2) shoot_laser(0,-8,laser_vert);
-    else if (DOWN2) shoot_laser(0,8,laser_vert); 
-    else if (LEFT2) shoot_laser(-8,0,laser_horiz);
-    else if (RIGHT2) shoot_laser(8,0,laser_horiz);
+    if (UP2) shoot_laser(0,-8,laser_vert,laser_vert_mask);
+    else if (DOWN2) shoot_laser(0,8,laser_vert,laser_vert_mask);
+    else if (LEFT2) shoot_laser(-8,0,laser_horiz,laser_horiz_mask);
+    else if (RIGHT2) shoot_laser(8,0,laser_horiz,laser_horiz_mask);
   }
 }
 
@@ -847,6 +992,59 @@ void effects_next() {
   }
 }
 
+// RASTER-CHASING SCHEDULER
+
+void update_band(byte b) {
+  Actor* a = band_lists[b];
+  Actor* next;
+  while (a) {
+    if ((frame & a->tick_mask) == a->tick_phase) {
+      update_actor(a);
+    }
+    // read next pointer after update, in case a neighbor was removed
+    next = a->next;
+    if (!a->shape) {
+      // shape became null, remove from list
+      remove_actor(a);
+    } else if (BAND_OF(a->y) != b) {
+      // rebucket at end of frame, so we don't update it twice
+      remove_actor(a);
+      add_actor(&migrate_list, a);
+    }
+    a = next;
+  }
+}
+
+void flush_band(byte b) {
+  byte top = b << BAND_SHIFT;
+  // wait for the beam to clear the band, doing effects meanwhile
+  while ((byte)(video_counter - top) < BAND_SPAN) {
+    effects_next();
+  }
+  if (blit_count > band_max_blits[b]) band_max_blits[b] = blit_count;
+  flush_blits();
+  // did the beam lap around and reach this band while we drew?
+  if ((byte)(video_counter - top) < BAND_SPAN) band_overruns[b]++;
+}
+
+void migrate_actors() {
+  Actor* a;
+  while ((a = migrate_list) != NULL) {
+    remove_actor(a);
+    add_actor_to_band(a);
+  }
+}
+
+void update_screen() {
+  byte b;
+  effects_new_frame();
+  for (b=0; b<NBANDS; b++) {
+    update_band(b);
+    flush_band(b);
+  }
+  migrate_actors();
+}
+
 Actor* new_actor() {
   Actor* a = free_list;
   remove_actor(a);
@@ -866,8 +1064,10 @@ void init() {
   blit_solid(0, 0, 255, 255, 0);
   memset(actors, 0, sizeof(actors));
   memcpy(palette, palette_data, 16);
-  player_list = fast_list = obstacle_list = free_list = NULL;
-  memset(slow_lists, 0, sizeof(slow_lists));
+  obstacle_list = free_list = migrate_list = NULL;
+  memset(band_lists, 0, sizeof(band_lists));
+  memset(grid, 0, sizeof(grid));
+  blit_count = 0;
   // add all actors to free list
   for (i=MAX_ACTORS-1; i>0; i--) {
     add_actor(&free_list, &actors[i]);
@@ -881,8 +1081,9 @@ void make_player_actors() {
   a->x = 128;
   a->y = 120;
   a->shape = (void*) playersprite1;
+  a->mask = playersprite1_mask;
   a->update = player_move;
-  add_actor(&player_list, a);
+  add_actor_to_band(a);
   // make laser
   a = new_actor();
   a->update = laser_move;
@@ -899,10 +1100,16 @@ void make_enemy_actors() {
       a->y = rand() + rand();
     } while ((byte)(a->x - 96) < 64 && (byte)(a->y - 96) < 64);
     a->shape = (void*) all_sprites[i%9];
+    a->mask = all_masks[i%9];
     a->update = random_walk;
     a->draw = draw_actor_normal;
-    if (i < 5) add_actor(&fast_list, a);
-    else add_actor(&slow_lists[i&3], a);
+    grid_add(a);
+    // first few are fast, the rest update every 4th frame
+    if (i >= 5) {
+      a->tick_mask = 3;
+      a->tick_phase = i & 3;
+    }
+    add_actor_to_band(a);
     WATCHDOG;
   }
 }
@@ -932,10 +1139,59 @@ void draw_playfield(Actor* a) {
   draw_box(0,0,275,255,0x11);
 }
 
+#ifdef BENCHMARK_COLLISIONS
+
+// test against every enemy, without the grid
+Actor* test_all_collisions() {
+  byte i;
+  for (i=LASER+1; i<MAX_ACTORS; i++) {
+    Actor* a = &actors[i];
+    if (a->cell_prevptr && test_collision_actor(a)) {
+      return a;
+    }
+  }
+  return NULL;
+}
+
+// count (in BCD) laser-sized collision queries done in one frame
+word collisions_per_frame(bool use_grid) {
+  word count = 0;
+  Actor* probe = &actors[LASER];
+  probe->shape = (void*) laser_horiz;
+  probe->mask = laser_horiz_mask;
+  while (video_counter != 0xfc) ;
+  while (video_counter == 0xfc) ;
+  do {
+    WATCHDOG;
+    probe->x = rand();
+    probe->y = rand();
+    setup_collision(probe);
+    if (use_grid)
+      test_grid_collisions();
+    else
+      test_all_collisions();
+    count = bcd_add(count, 1);
+  } while (video_counter != 0xfc);
+  probe->shape = NULL;
+  return count;
+}
+
+void benchmark_collisions() {
+  draw_string("Scan", 278, 40, 0xee);
+  draw_bcd_word(collisions_per_frame(false), 278, 52, 0xff);
+  draw_string("Grid", 278, 68, 0xee);
+  draw_bcd_word(collisions_per_frame(true), 278, 80, 0xff);
+}
+
+#endif
+
 void main() {
   init();
   make_player_actors();
   make_enemy_actors();
+#ifdef BENCHMARK_COLLISIONS
+  benchmark_collisions();
+#endif
   // add low-priority effects here, because new effects
   // are added to the head of the list
   new_effect(draw_score);
@@ -943,11 +1199,7 @@ void main() {
   // main loop
   while (actors[PLAYER].shape) {
     WATCHDOG;
-    effects_new_frame();
-    while (video_counter >= 0x90) effects_next();
-    update_screen_section(1);
-    while (video_counter < 0x90) effects_next();
-    update_screen_section(0);
+    update_screen();
     switch (frame & 7) {
       case 0:
         break;
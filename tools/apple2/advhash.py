@@ -0,0 +1,109 @@
+#!/usr/bin/python3
+
+# Generate a perfect hash for a text adventure vocabulary.
+# Reads the item enum (first enum ending in "} Item_t;") and the
+# DescriptionOfItem[] names from a C file, adds the extra words given
+# as word=Token, and prints tables for findWord():
+#
+#   a = VOCAB_SEED, b = 0
+#   for each char c:  c |= 0x20;  a = rotate_left(a, 3) ^ c;  b = b*2 + c
+#   slot = (b + vocabDisp[a & (VOCAB_BUCKETS-1)]) & (VOCAB_SLOTS-1)
+#
+# vocabText[slot] is the only word that can be in that slot (compare
+# it to reject other input) and vocabToken[slot] is its token.
+
+import sys, re, argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('cfile', help="C source file with Item_t and DescriptionOfItem")
+parser.add_argument('words', nargs='*', help="extra words, word=Token")
+args = parser.parse_args()
+
+with open(args.cfile, 'r') as f:
+    src = f.read()
+
+m = re.search(r'typedef\s+enum\s*\{([^}]*)\}\s*Item_t\s*;', src)
+if not m:
+    sys.exit("can't find Item_t")
+names = []
+for v in re.sub(r'/\*.*?\*/', '', m.group(1), flags=re.DOTALL).split(','):
+    v = v.strip()
+    if v and '=' not in v:
+        names.append(v)
+m = re.search(r'DescriptionOfItem\s*\[[^\]]*\]\s*=\s*\{(.*?)\};', src, re.DOTALL)
+if not m:
+    sys.exit("can't find DescriptionOfItem")
+texts = re.findall(r'"([^"]*)"', m.group(1))
+if len(texts) != len(names):
+    sys.exit("%d items but %d names" % (len(names), len(texts)))
+
+vocab = [(t.lower(), n) for t, n in zip(texts, names) if t]
+for w in args.words:
+    word, _, token = w.partition('=')
+    vocab.append((word.lower(), token))
+words = [w for w, t in vocab]
+if len(set(words)) != len(words):
+    sys.exit("duplicate words")
+
+def hashes(word, seed):
+    a, b = seed, 0
+    for ch in word:
+        c = ord(ch) | 0x20
+        a = (((a << 3) | (a >> 5)) & 0xff) ^ c
+        b = (b * 2 + c) & 0xff
+    return a, b
+
+def place(nslots, nbuckets, seed):
+    buckets = [[] for i in range(nbuckets)]
+    for i, w in enumerate(words):
+        a, b = hashes(w, seed)
+        buckets[a & (nbuckets-1)].append((b, i))
+    disp = [0] * nbuckets
+    slots = [None] * nslots
+    # biggest buckets first, while there is room
+    for bi in sorted(range(nbuckets), key=lambda i: -len(buckets[i])):
+        for d in range(0, 256):
+            s = [(b + d) & (nslots-1) for b, i in buckets[bi]]
+            if len(set(s)) == len(s) and all(slots[x] is None for x in s):
+                for x, (b, i) in zip(s, buckets[bi]):
+                    slots[x] = i
+                disp[bi] = d
+                break
+        else:
+            return None
+    return disp, slots
+
+nslots = 1
+while nslots < len(words):
+    nslots *= 2
+result = None
+while not result:
+    if nslots > 256:
+        sys.exit("can't hash %d words" % len(words))
+    nbuckets = max(1, nslots // 4)
+    for seed in range(0, 256):
+        result = place(nslots, nbuckets, seed)
+        if result:
+            break
+    else:
+        nslots *= 2
+disp, slots = result
+
+print("/* generated by tools/apple2/advhash.py -- do not edit */")
+print("#define VOCAB_SEED %d" % seed)
+print("#define VOCAB_BUCKETS %d" % nbuckets)
+print("#define VOCAB_SLOTS %d" % nslots)
+print("const unsigned char vocabDisp[VOCAB_BUCKETS] = {")
+for i in range(0, nbuckets, 16):
+    print("    " + ", ".join(["%d" % d for d in disp[i:i+16]]) + ",")
+print("};")
+print("const unsigned char vocabToken[VOCAB_SLOTS] = {")
+for i in range(0, nslots, 4):
+    print("    " + " ".join(["%s," % (vocab[s][1] if s is not None else "NoWord")
+                            for s in slots[i:i+4]]))
+print("};")
+print("const char *vocabText[VOCAB_SLOTS] = {")
+for i in range(0, nslots, 4):
+    print("    " + " ".join(['"%s",' % (vocab[s][0] if s is not None else "")
+                            for s in slots[i:i+4]]))
+print("};")
@@ -0,0 +1,49 @@
+#!/usr/bin/python3
+
+# Generate pre-shifted Apple II hi-res sprites.
+# Reads "const byte name_bitmap[] = { w,h, data... };" arrays from a C file
+# and prints a "const byte name_shifted[7][(w+1)*h]" array, one copy for
+# each x MOD 7, plus a ShiftedSprite "name_sprite" pointing to them.
+# Each shifted row is w+1 bytes; the output is bit-for-bit what the
+# shift-as-you-go render_sprite() in cosmic.c writes to the screen.
+
+import sys, os, re, argparse
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..'))
+import carray
+
+parser = argparse.ArgumentParser()
+parser.add_argument('cfile', help="C source file with sprite arrays")
+parser.add_argument('names', nargs='*', help="sprite names (default: all *_bitmap)")
+args = parser.parse_args()
+
+def shift_row(row, xs):
+    out = []
+    rest = 0
+    for data in row:
+        out.append(((data << xs) | rest) & 0xff)
+        rest = data >> (7-xs)
+    out.append(rest)
+    return out
+
+for name, values in carray.read_arrays(args.cfile):
+    if args.names:
+        if name not in args.names:
+            continue
+    elif not name.endswith('_bitmap'):
+        continue
+    spr = carray.sprite(values)
+    if not spr:
+        continue
+    width, height, data = spr
+    base = re.sub(r'_bitmap$', '', name)
+    size = (width+1)*height
+    print("const byte %s_shifted[7][%d] = {" % (base, size))
+    for xs in range(0, 7):
+        out = []
+        for y in range(0, height):
+            out += shift_row(data[y*width:(y+1)*width], xs)
+        print("{" + ",".join(['0x%02X' % v for v in out]) + "},")
+    print("};")
+    print("const ShiftedSprite %s_sprite = {%d,%d,{" % (base, width+1, height))
+    print("  " + ",".join(['%s_shifted[%d]' % (base, xs) for xs in range(0, 7)]) + "}};")
@@ -0,0 +1,165 @@
+#!/usr/bin/python3
+
+# Generate the expected-value tables for the YUM computer player
+# (presets/apple2/yum.c, OPTIMAL_AI).
+#
+# A multiset of dice is numbered by its size and its place among the
+# sorted dice lists of that size, so the 252 five-dice rolls are 0-251.
+# diceNext[n][f-1] is the number of multiset n (numbered over all sizes
+# 0-4, the sizes in order) with one more die showing f.
+#
+# yumValue[used] is the score you can expect from the categories not in
+# "used" when playing each turn the best way: bit i is category i for
+# the upper section (0-5) and bit 6+i is category 8+i.  The table leaves
+# out the upper-section bonus and scores Low Score and High Score on
+# their own (both would multiply the size of the table).  To fit in
+# memory it is split in a part for the upper bits and a part for the
+# lower bits, each also indexed by the number of categories used in
+# the other half:
+#
+#   yumValue[used] ~ upperValue[used & 63][popcount(used >> 6)]
+#                  + lowerValue[used >> 6][popcount(used & 63)]
+#
+# in units of VALUE_SCALE points.
+
+import sys, argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('--check', action='store_true', help="print the exact values and the error")
+args = parser.parse_args()
+
+NCAT = 12
+CATEGORY = [0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13]
+VALUE_SCALE = 2
+
+# multisets of each size, as sorted tuples, in lexicographic order
+def multisets(n, lo=1):
+    if n == 0:
+        return [()]
+    return [(d,) + rest for d in range(lo, 7) for rest in multisets(n - 1, d)]
+
+sets = [multisets(n) for n in range(6)]
+index = [dict((m, i) for i, m in enumerate(s)) for s in sets]
+base = [0]
+for n in range(5):
+    base.append(base[-1] + len(sets[n]))
+
+def add(m, f):
+    return tuple(sorted(m + (f,)))
+
+# next tables, numbered within the next size
+nxt = [[[index[n+1][add(m, f)] for f in range(1, 7)] for m in sets[n]] for n in range(5)]
+
+def score(m, c):
+    s = sum(m)
+    if c < 6:
+        return m.count(c + 1) * (c + 1)
+    if c == 8:
+        return 15 if m == (1, 2, 3, 4, 5) else 0
+    if c == 9:
+        return 20 if m == (2, 3, 4, 5, 6) else 0
+    if c == 10:
+        return s if s >= 21 else 0
+    if c == 11:
+        return s if s >= 22 else 0
+    if c == 12:
+        return 25 if m[0] == m[2] and m[3] == m[4] or m[0] == m[1] and m[2] == m[4] else 0
+    if c == 13:
+        return 30 if m[0] == m[4] else 0
+
+scores = [[score(m, CATEGORY[b]) for b in range(NCAT)] for m in sets[5]]
+
+def average(top):
+    # top[i] is the value of five dice number i; returns the values of
+    # keeping each smaller multiset and rolling the others once
+    vals = [None] * 5 + [top]
+    for n in range(4, -1, -1):
+        up = vals[n+1]
+        vals[n] = [sum([up[j] for j in row]) / 6.0 for row in nxt[n]]
+    return vals
+
+def best_keep(vals):
+    # value of each five dice with a roll left: the best multiset to keep
+    g = [list(v) for v in vals]
+    for n in range(5):
+        for i, row in enumerate(nxt[n]):
+            for j in row:
+                if g[n][i] > g[n+1][j]:
+                    g[n+1][j] = g[n][i]
+    return g[5]
+
+# exact values, from all categories used back to none used
+value = [0.0] * (1 << NCAT)
+for used in range((1 << NCAT) - 2, -1, -1):
+    after = [(b, value[used | (1 << b)]) for b in range(NCAT) if not used & (1 << b)]
+    f0 = [max([row[b] + v for b, v in after]) for row in scores]
+    f1 = best_keep(average(f0))
+    f2 = best_keep(average(f1))
+    e3 = average(f2)
+    value[used] = e3[0][0]
+
+def popcount(x):
+    return bin(x).count('1')
+
+# split fit: average over each (part, popcount of other part) cell, then
+# a few passes of fitting each half to what the other half leaves over
+upper = [[0.0] * 7 for i in range(64)]
+lower = [[0.0] * 7 for i in range(64)]
+for it in range(20):
+    for tab, part, other in ((upper, lambda u: u & 63, lambda u: u >> 6),
+                             (lower, lambda u: u >> 6, lambda u: u & 63)):
+        acc = [[[] for k in range(7)] for i in range(64)]
+        for used in range(1 << NCAT):
+            rest = value[used] - (lower[used >> 6][popcount(used & 63)] if tab is upper
+                                  else upper[used & 63][popcount(used >> 6)])
+            acc[part(used)][popcount(other(used))].append(rest)
+        for i in range(64):
+            for k in range(7):
+                tab[i][k] = sum(acc[i][k]) / len(acc[i][k]) if acc[i][k] else 0.0
+
+# move what all upperValue[][k] have in common to the lowerValue rows
+# with k bits, so both are positive
+for k in range(7):
+    low = min([upper[i][k] for i in range(64)])
+    for i in range(64):
+        upper[i][k] -= low
+        if popcount(i) == k:
+            lower[i] = [v + low for v in lower[i]]
+
+# round to bytes, then fix the lower half again against the rounded upper half
+qupper = [[int(round(v * VALUE_SCALE)) for v in row] for row in upper]
+acc = [[[] for k in range(7)] for i in range(64)]
+for used in range(1 << NCAT):
+    acc[used >> 6][popcount(used & 63)].append(value[used] * VALUE_SCALE - qupper[used & 63][popcount(used >> 6)])
+qlower = [[max(0, int(round(sum(a) / len(a)))) for a in row] for row in acc]
+for row in qupper + qlower:
+    for v in row:
+        if v < 0 or v > 255:
+            sys.exit("value %d doesn't fit in a byte" % v)
+
+def packed(used):
+    return (qupper[used & 63][popcount(used >> 6)] + qlower[used >> 6][popcount(used & 63)]) / float(VALUE_SCALE)
+
+err = [abs(packed(u) - value[u]) for u in range(1 << NCAT)]
+
+if args.check:
+    for u in range(1 << NCAT):
+        print("%03x %7.2f %7.2f" % (u, value[u], packed(u)))
+    print("max error %.2f, mean %.3f" % (max(err), sum(err) / len(err)))
+    sys.exit(0)
+
+def carray(ctype, name, values, per_line=16):
+    print("const %s %s[%d] = {" % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        print("  " + ",".join(["%d" % v for v in values[i:i+per_line]]) + ",")
+    print("};")
+
+print("/* generated by tools/apple2/yumtab.py -- do not edit */")
+print("/* expected score %.1f, table off by at most %.1f points */" % (value[0], max(err)))
+print("#define VALUE_SCALE %d" % VALUE_SCALE)
+print("#define SMALL_SETS %d" % base[5])
+print("#define ROLL_SETS %d" % len(sets[5]))
+print("const unsigned char setBase[6] = { %s };" % ", ".join(["%d" % b for b in base]))
+carray("unsigned char", "diceNext", [j for n in range(5) for row in nxt[n] for j in row], per_line=18)
+carray("unsigned char", "upperValue", [v for row in qupper for v in row], per_line=14)
+carray("unsigned char", "lowerValue", [v for row in qlower for v in row], per_line=14)
@@ -0,0 +1,129 @@
+#!/usr/bin/python3
+
+# Generate pre-shifted, pre-masked Astrocade sprites as Z80 code.
+# Reads "const byte NAME[] = { bytewidth,height, data... };" arrays from
+# a C file (the acfast.s pattern format) and prints an sdasz80 source file
+# with one routine per pixel shift (x MOD 4).  Each routine writes the
+# sprite straight to screen RAM, HL = destination (__z88dk_fastcall):
+#   fully opaque bytes are stored with "ld (hl),#n",
+#   partly transparent bytes are masked with "and"/"or",
+#   fully transparent bytes are skipped.
+# A PrebakedSprite "_NAME_prebaked" (see acfast.h) points to the routines.
+#
+# Transparent pixels are color 0, unless a mask array is given with
+# NAME:MASKNAME, in which case the mask's nonzero pixels are opaque.
+#
+# The estimated cycle counts are printed next to those of the magic
+# register path (fast_sprite_8/16, twice when a mask is needed), so
+# you can see which way is cheaper for each sprite.
+
+import sys, os, argparse
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..'))
+import carray
+
+parser = argparse.ArgumentParser()
+parser.add_argument('cfile', help="C source file with sprite arrays")
+parser.add_argument('names', nargs='+', help="sprite names, NAME or NAME:MASKNAME")
+parser.add_argument('--area', default='_CODE', help="linker area")
+args = parser.parse_args()
+
+VBWIDTH = 40
+
+arrays = dict(carray.read_arrays(args.cfile))
+
+def opaque_mask(b):
+    # 0b11 for each nonzero 2-bit pixel
+    m = 0
+    for i in range(0, 8, 2):
+        if (b >> i) & 3:
+            m |= 3 << i
+    return m
+
+def shift_row(row, xs):
+    # shift right xs pixels, like the magic register does
+    out = []
+    rest = 0
+    for data in row:
+        out.append((data >> (xs*2)) | rest)
+        rest = (data << (8-xs*2)) & 0xff
+    out.append(rest)
+    return out
+
+# T-states of fast_sprite_8/16 for one sprite, including the call
+def magic_cycles(width, height):
+    return 120 + height * (width*16 + 48)
+
+def emit_shift(xs, width, height, data, mask):
+    lines = []
+    t = 10          # ret
+    regs = {'de': None, 'bc': None}
+    lru = ['bc', 'de']
+    pos = 0
+    for y in range(0, height):
+        drow = shift_row(data[y*width:(y+1)*width], xs)
+        mrow = shift_row(mask[y*width:(y+1)*width], xs)
+        for x in range(0, width+1):
+            m, d = mrow[x], drow[x] & mrow[x]
+            if m == 0:
+                continue
+            target = y*VBWIDTH + x
+            delta = target - pos
+            if delta in (1, 2):
+                lines += ['  inc\thl'] * delta
+                t += 6 * delta
+            elif delta:
+                reg = [r for r in regs if regs[r] == delta]
+                if reg:
+                    reg = reg[0]
+                else:
+                    reg = lru[0]
+                    regs[reg] = delta
+                    lines.append('  ld\t%s,#%d' % (reg, delta))
+                    t += 10
+                lru.remove(reg)
+                lru.append(reg)
+                lines.append('  add\thl,%s' % reg)
+                t += 11
+            pos = target
+            if m == 0xff:
+                lines.append('  ld\t(hl),#0x%02x' % d)
+                t += 10
+            else:
+                lines.append('  ld\ta,(hl)')
+                lines.append('  and\t#0x%02x' % (m ^ 0xff))
+                t += 14
+                if d:
+                    lines.append('  or\t#0x%02x' % d)
+                    t += 7
+                lines.append('  ld\t(hl),a')
+                t += 7
+    lines.append('  ret')
+    return lines, t
+
+print("; generated by tools/astrocade/acsprite.py -- do not edit")
+print(".area\t%s" % args.area)
+for arg in args.names:
+    name, _, maskname = arg.partition(':')
+    width, height, data = carray.sprite(arrays[name])
+    if maskname:
+        mask = [opaque_mask(b) for b in carray.sprite(arrays[maskname])[2]]
+    else:
+        mask = [opaque_mask(b) for b in data]
+    magic = magic_cycles(width, height) * (2 if maskname else 1)
+    print()
+    print("; %s: %d x %d bytes" % (name, width, height))
+    print("; magic register: ~%d cycles" % magic)
+    routines = []
+    for xs in range(0, 4):
+        label = '_%s_s%d' % (name, xs)
+        code, t = emit_shift(xs, width, height, data, mask)
+        print("; %s: ~%d cycles" % (label, t))
+        routines.append((label, code))
+    print(".globl\t_%s_prebaked" % name)
+    print("_%s_prebaked:" % name)
+    print("  .db\t%d,%d" % (width+1, height))
+    print("  .dw\t" + ",".join([r[0] for r in routines]))
+    for label, code in routines:
+        print("%s:" % label)
+        print("\n".join(code))
@@ -0,0 +1,108 @@
+#!/usr/bin/python3
+
+# bake shifted or mirrored copies of a preset's pattern tables
+# into RLE data for rle_to_vram() (presets/coleco/common.c)
+#
+#   --shift  16-byte pairs of characters, shifted 0-7 pixels right
+#            into 24-byte triples, like set_shifted_pattern()
+#   --flip   16x16 sprites mirrored left to right, like
+#            flip_sprite_patterns()
+#
+# python3 tools/bakepatterns.py --shift presets/coleco/shoot.c pattern_table
+
+import sys, re, argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('file', help="C source with the tables")
+parser.add_argument('array', nargs='+', help="tables to use, one after the other")
+parser.add_argument('-s', '--shift', action='store_true', help="pre-shift character pairs")
+parser.add_argument('-f', '--flip', action='store_true', help="mirror 16x16 sprites")
+parser.add_argument('-n', '--name', help="C name of the result")
+args = parser.parse_args()
+
+source = open(args.file).read()
+source = re.sub(r'/\*.*?\*/', '', source, flags=re.S)
+source = re.sub(r'//.*', '', source)
+
+def read_array(name):
+    m = re.search(r'\b' + name + r'\s*(\[[^=]*\])?\s*=\s*\{(.*?)\}\s*;', source, re.S)
+    if not m:
+        sys.exit("%s: no array %s" % (args.file, name))
+    return [int(x, 0) for x in re.findall(r'0[xX][0-9a-fA-F]+|\d+', m.group(2))]
+
+def shifted(data):
+    out = []
+    for shift in range(8):
+        for i in range(0, len(data), 16):
+            a = data[i+8:i+16]
+            b = data[i:i+8]
+            out += [x >> shift for x in a]
+            out += [((y >> shift) | (x << (8-shift))) & 0xff for x, y in zip(a, b)]
+            out += [(y << (8-shift)) & 0xff for y in b]
+    return out
+
+def reverse_bits(x):
+    return int('{:08b}'.format(x)[::-1], 2)
+
+def flipped(data):
+    out = [0] * len(data)
+    for i, x in enumerate(data):
+        out[i ^ 16] = reverse_bits(x)
+    return out
+
+# 0 = end, 1-127 = that many bytes follow,
+# 128-255 = the next byte 2-129 times
+def rle(data):
+    out = []
+    lits = []
+    i = 0
+    while i < len(data):
+        n = 1
+        while i+n < len(data) and n < 129 and data[i+n] == data[i]:
+            n += 1
+        if n >= 3:
+            if lits:
+                out += [len(lits)] + lits
+                lits = []
+            out += [0x80 + n - 2, data[i]]
+            i += n
+        else:
+            lits.append(data[i])
+            if len(lits) == 127:
+                out += [len(lits)] + lits
+                lits = []
+            i += 1
+    if lits:
+        out += [len(lits)] + lits
+    return out + [0]
+
+def unrle(data):
+    out = []
+    i = 0
+    while data[i]:
+        n = data[i]
+        if n & 0x80:
+            out += [data[i+1]] * ((n & 0x7f) + 2)
+            i += 2
+        else:
+            out += data[i+1:i+1+n]
+            i += 1 + n
+    return out
+
+data = []
+for name in args.array:
+    data += read_array(name)
+if args.shift:
+    data = shifted(data)
+if args.flip:
+    data = flipped(data)
+packed = rle(data)
+assert unrle(packed) == data
+
+name = args.name or args.array[0] + ('_shifted' if args.shift else '') + ('_flipped' if args.flip else '')
+print("// python3 tools/bakepatterns.py %s" % " ".join(sys.argv[1:]))
+print("// %d bytes, %d packed" % (len(data), len(packed)))
+print("const byte %s[%d] = {" % (name, len(packed)))
+for i in range(0, len(packed), 16):
+    print("  " + "".join("0x%02x," % x for x in packed[i:i+16]))
+print("};")
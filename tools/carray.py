@@ -0,0 +1,37 @@
+# Read "const byte name[] = { ... };" arrays out of a preset's C source,
+# for the sprite generators in the machine directories, which import it
+# with:
+#
+#   sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..'))
+#   import carray
+
+import re
+
+re_array = re.compile(r'const\s+byte\s+(\w+)\s*\[[^\]]*\]\s*=\s*\{(.*?)\};', re.DOTALL)
+re_comment = re.compile(r'/\*.*?\*/|//[^\n]*', re.DOTALL)
+
+# (name, values) for each array, in file order; arrays that aren't
+# all numbers are left out
+def read_arrays(filename):
+    with open(filename, 'r') as f:
+        src = f.read()
+    arrays = []
+    for m in re_array.finditer(src):
+        body = re_comment.sub('', m.group(2))
+        try:
+            values = [int(v, 0) for v in body.replace('\n', '').split(',') if v.strip()]
+        except ValueError:
+            continue
+        arrays.append((m.group(1), values))
+    return arrays
+
+# split a sprite, { width,height, data... }, into (width, height, data);
+# missing rows are zero-filled, as in C.  None if it can't be a sprite.
+def sprite(values):
+    if len(values) < 2:
+        return None
+    width, height = values[0], values[1]
+    data = values[2:]
+    if not width or not height or len(data) > width*height:
+        return None
+    return width, height, data + [0] * (width*height-len(data))
@@ -0,0 +1,181 @@
+#!/usr/bin/python3
+
+# Generate the compressed Eliza tables.
+# Reads the plain keywords[], responses[][] and ResponsesPerKeyword[]
+# arrays from an Eliza C file and prints C source for COMPRESSED_TEXT:
+#
+# - Keyword groups that have the same responses share one copy.
+# - The responses are byte-pair encoded: codes 0x80-0xFF each stand
+#   for a pair of codes (pair_left, pair_right), which may be pairs
+#   themselves, up to PAIR_DEPTH deep.  Each response ends with a 0.
+# - The keywords (except the last, the default) are a trie.  trie_root
+#   is indexed by the first character - ' '; the other nodes list their
+#   children from trie_edge[node] to trie_edge[node+1].  trie_keyword is
+#   the lowest keyword index ending at each node, or NOKEYWORD.
+
+import sys, re, argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('cfile', help="C source file with the plain tables")
+parser.add_argument('--pairs', type=int, default=128, help="max pair codes")
+args = parser.parse_args()
+
+re_string = re.compile(r'"((?:[^"\\]|\\.)*)"')
+
+with open(args.cfile, 'r') as f:
+    src = f.read()
+
+def array_body(name):
+    m = re.search(r'\b' + name + r'\s*(\[[^\]]*\])+\s*=\s*\{', src)
+    if not m:
+        sys.exit("can't find " + name)
+    # find the matching close brace
+    depth = 1
+    i = m.end()
+    while depth:
+        if src[i] == '{':
+            depth += 1
+        elif src[i] == '}':
+            depth -= 1
+        elif src[i] == '"':
+            i = src.index('"', i+1)
+        i += 1
+    return src[m.end():i-1]
+
+def unescape(s):
+    return s.encode('latin-1').decode('unicode_escape')
+
+keywords = [unescape(s) for s in re_string.findall(array_body('keywords'))]
+counts = [int(v) for v in array_body('ResponsesPerKeyword').split(',') if v.strip()]
+groups = [[unescape(s) for s in re_string.findall(g)]
+          for g in re.findall(r'\{([^{}]*)\}', array_body('responses'))]
+if not (len(keywords) == len(counts) == len(groups)):
+    sys.exit("%d keywords, %d counts, %d response groups" % (len(keywords), len(counts), len(groups)))
+for k, (n, g) in enumerate(zip(counts, groups)):
+    if n != len(g):
+        sys.exit("keyword %s: count %d but %d responses" % (keywords[k], n, len(g)))
+
+# share identical groups
+responses = []
+first = []
+for g in groups:
+    for i in range(0, len(responses) - len(g) + 1):
+        if responses[i:i+len(g)] == g:
+            first.append(i)
+            break
+    else:
+        first.append(len(responses))
+        responses += g
+if len(responses) > 255:
+    sys.exit("too many responses")
+
+# byte pair encoding
+for s in responses:
+    for ch in s:
+        if ord(ch) < 1 or ord(ch) > 127:
+            sys.exit("can't encode %r" % ch)
+texts = [[ord(ch) for ch in s] for s in responses]
+pairs = []
+while len(pairs) < args.pairs:
+    freq = {}
+    for t in texts:
+        i = 0
+        while i < len(t) - 1:
+            p = (t[i], t[i+1])
+            freq[p] = freq.get(p, 0) + 1
+            # don't count overlapping runs (aaa) twice
+            i += 2 if i < len(t) - 2 and t[i+2] == t[i] and t[i+1] == t[i] else 1
+    if not freq:
+        break
+    best = max(freq, key=lambda p: (freq[p], -p[0], -p[1]))
+    # each pair costs 2 bytes in the tables
+    if freq[best] <= 2:
+        break
+    code = 0x80 + len(pairs)
+    pairs.append(best)
+    for j, t in enumerate(texts):
+        out = []
+        i = 0
+        while i < len(t):
+            if i < len(t) - 1 and (t[i], t[i+1]) == best:
+                out.append(code)
+                i += 2
+            else:
+                out.append(t[i])
+                i += 1
+        texts[j] = out
+
+def depth(code):
+    if code < 0x80:
+        return 0
+    l, r = pairs[code - 0x80]
+    # the right half waits on the stack while the left half expands
+    return max(1 + depth(l), depth(r))
+
+maxdepth = max([depth(0x80 + i) for i in range(len(pairs))] + [0])
+
+packed = []
+offsets = []
+for t in texts:
+    offsets.append(len(packed))
+    packed += t + [0]
+
+# keyword trie, node 0 is the root
+NOKEYWORD = 0xff
+children = [{}]
+kwnode = [NOKEYWORD]
+for k, kw in enumerate(keywords[:-1]):
+    node = 0
+    for ch in kw:
+        if ch not in children[node]:
+            children[node][ch] = len(children)
+            children.append({})
+            kwnode.append(NOKEYWORD)
+        node = children[node][ch]
+    kwnode[node] = min(kwnode[node], k)
+if len(children) > 255:
+    sys.exit("too many trie nodes")
+for ch in children[0]:
+    if ord(ch) < 0x20 or ord(ch) > 0x5f:
+        sys.exit("keyword starts with %r" % ch)
+
+edge_start = []
+edge_char = []
+edge_next = []
+for node in range(len(children)):
+    edge_start.append(len(edge_char))
+    if node:
+        for ch in sorted(children[node]):
+            edge_char.append(ord(ch))
+            edge_next.append(children[node][ch])
+edge_start.append(len(edge_char))
+root = [children[0].get(chr(c), 0) for c in range(0x20, 0x60)]
+
+textsize = sum([len(s) + 1 for s in responses])
+packedsize = len(packed) + len(pairs)*2
+
+def carray(ctype, name, values, per_line=16, fmt='%d'):
+    print("const %s %s[%d] = {" % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        print("  " + ",".join([fmt % v for v in values[i:i+per_line]]) + ",")
+    print("};")
+
+print("/* generated by tools/elizadict.py -- do not edit */")
+print("/* %d responses, %d bytes of text packed into %d bytes */" %
+      (len(responses), textsize, packedsize))
+print("#define NUMRESPONSES %d" % len(responses))
+print("#define NUMPAIRS %d" % len(pairs))
+print("#define PAIR_DEPTH %d" % maxdepth)
+print("#define TRIE_NODES %d" % len(children))
+print("#define NOKEYWORD %d" % NOKEYWORD)
+carray("unsigned char", "pair_left", [p[0] for p in pairs], fmt='0x%02x')
+carray("unsigned char", "pair_right", [p[1] for p in pairs], fmt='0x%02x')
+carray("unsigned char", "packed_text", packed, fmt='0x%02x')
+carray("unsigned short", "response_ofs", offsets, per_line=12)
+carray("unsigned char", "first_response", first)
+carray("unsigned char", "keyword_len", [len(kw) for kw in keywords])
+carray("unsigned char", "trie_root", root)
+carray("unsigned char", "trie_edge", edge_start)
+carray("char", "edge_char", edge_char, fmt="'%c'")
+carray("unsigned char", "edge_next", edge_next)
+carray("unsigned char", "trie_keyword", kwnode)
@@ -12,6 +12,8 @@ parser.add_argument('-t', '--tempo', type=int, default=48, help="tempo")
 parser.add_argument('-o', '--one', action="store_true", help="one voice per channel")
 parser.add_argument('-z', '--compress', action="store_true", help="compress song (experimental)")
 parser.add_argument('-H', '--hex', action="store_true", help="hex output")
+parser.add_argument('-a', '--ay', action="store_true", help="AY sound driver format with note volumes (presets/vicdual/aysound.h)")
+parser.add_argument('-l', '--loop', action="store_true", help="loop the song (with --ay)")
 parser.add_argument('midifile', help="MIDI file")
 parser.add_argument('midichannels', nargs='?', help="comma-separated list of MIDI channels, or -")
 args = parser.parse_args()
@@ -24,6 +26,13 @@ tempo = args.tempo
 compress = args.compress
 transpose = args.transpose
 coutput = not args.hex
+ay_format = args.ay
+
+# aysound.h: notes are 0x00-0x3f, 0x40-0x4f sets the volume
+if ay_format:
+    if compress:
+        sys.exit("--compress can't be used with --ay")
+    max_note = min(max_note, min_note + 63)
 
 # for 2600
 #max_voices = 2
@@ -123,6 +132,7 @@ else:
     nnotes = 0
     nvoices = 0
     curchans = 0
+    curvolume = 15
     channels = [int(x) for x in args.midichannels.split(',')]
     print ('')
     print(("// %s %s" % (mid, channels)))
@@ -144,11 +154,16 @@ else:
                 if note >= min_note and note <= max_note and nvoices < max_voices:
                     if not (one_voice_per_channel and (curchans & (1<<msg.channel))):
                         n = note - min_note
+                        if ay_format:
+                            volume = max(1, vel >> 3)
+                            if volume != curvolume:
+                                output.append(0x40 + volume)
+                                curvolume = volume
                         output.append(n)
                         nnotes += 1
                         nvoices += 1
                         curchans |= 1<<msg.channel
-    output.append(0xff)
+    output.append(0xfe if ay_format and args.loop else 0xff)
     if coutput:
         print((','.join([hex2(x) for x in output])))
     else:
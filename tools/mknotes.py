@@ -6,13 +6,17 @@ parser = argparse.ArgumentParser()
 parser.add_argument('-l', '--length', type=int, default=64, help="length of note table")
 parser.add_argument('-u', '--upper', type=int, default=49, help="upper note # to test")
 parser.add_argument('-f', '--freq', type=float, default=3579545/32.0, help="base frequency (Hz)")
+parser.add_argument('-c', '--clock', type=float, help="chip clock (Hz), instead of --freq")
+parser.add_argument('-p', '--prescale', type=float, default=32, help="clock divider before the period (32 for SN76489, 16 for AY-3-8910)")
+parser.add_argument('-t', '--type', default="const int", help="C type of the table")
+parser.add_argument('-n', '--name', default="note_table", help="C name of the table")
 parser.add_argument('-b', '--bias', type=float, default=0, help="divisor bias")
 parser.add_argument('-m', '--maxbits', type=float, default=12, help="max. # of bits")
 args = parser.parse_args()
 
 test_notes = args.upper
 final_notes = args.length
-basehz = args.freq
+basehz = args.clock / args.prescale if args.clock else args.freq
 bias = args.bias
 maxval = (1<<int(args.maxbits))-1
 
@@ -24,7 +28,7 @@ for a440 in range(4300,4500):
         notehz = a440 / 10.0 * math.pow(2.0, (note - 49) / 12.0);
         period = int(round(basehz / notehz)) 
         while period > maxval:
-            period /= 2
+            period //= 2
         tonehz = basehz / period
         error += abs(notehz-tonehz)
         #print a440,note,notehz,notehz-tonehz,period
@@ -38,11 +42,11 @@ best_a440 /= 10.0
 print('//', args)
 print('//', best_a440, best_error, test_notes)
 
-print("const int note_table[%d] = {" % final_notes)
+print("%s %s[%d] = {" % (args.type, args.name, final_notes))
 for note in range(0,final_notes):
     notehz = best_a440 * math.pow(2.0, (note - 49) / 12.0);
     period = int(round(basehz / notehz)) - bias
     while period > maxval:
-        period /= 2
+        period //= 2
     print('%d,' % period, end='')
 print("};")
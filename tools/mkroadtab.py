@@ -0,0 +1,16 @@
+
+# road curve table for presets/astrocade/racing.c
+# x offset of road center on each ground line (0 = bottom)
+# for each curvature; same as accumulating inc += curve per line
+
+cmin = -20
+cmax = 21
+lines = 45
+
+print("const sbyte ROAD_CURVE[%d][%d] = {" % (cmax-cmin+1, lines))
+for c in range(cmin, cmax+1):
+    print("{", end='')
+    for y in range(0, lines):
+        print("%d," % ((c * (y*(y-1)//2)) >> 8), end='')
+    print("},")
+print("};")
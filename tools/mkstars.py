@@ -0,0 +1,89 @@
+#!/usr/bin/python3
+
+# parallax starfield tables for presets/coleco/stars.c
+#
+# Each layer is 16 characters (128 pixel rows) holding a few one-pixel
+# stars, and every screen column shows one layer.  A layer moves down
+# a pixels every b frames; for each of those steps we list the runs of
+# pattern bytes that change, with the new bytes, so the game only
+# queues a copy per run.
+#
+# python3 tools/mkstars.py -l 1/4,4,2 -l 1/2,14,1 -l 1,15,1
+
+import sys, random, argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('-l', '--layer', action='append', help="speed (pixels/frames),color,stars for each layer, farthest first")
+parser.add_argument('-g', '--gap', type=int, default=2, help="join runs at most this many unchanged bytes apart")
+parser.add_argument('-s', '--seed', type=int, default=1, help="random seed")
+args = parser.parse_args()
+
+HEIGHT = 128
+COLUMNS = 32
+
+random.seed(args.seed)
+layers = []
+for spec in args.layer or ['1/4,4,2', '1/2,14,1', '1,15,1']:
+    speed, color, nstars = spec.split(',')
+    a, b = (speed.split('/') + ['1'])[:2]
+    a, b, nstars = int(a), int(b), int(nstars)
+    # spread the stars out, each at a random row in its slice
+    stars = []
+    for i in range(nstars):
+        row = i * HEIGHT // nstars + random.randrange(HEIGHT // nstars - 1)
+        stars.append((row, 0x80 >> random.randrange(8)))
+    layers.append((a, b, int(color), stars))
+
+def image(stars, pos):
+    img = [0] * HEIGHT
+    for row, mask in stars:
+        img[(row + pos) % HEIGHT] |= mask
+    return img
+
+def runs(old, new):
+    changed = [i for i in range(HEIGHT) if old[i] != new[i]]
+    out = []
+    for i in changed:
+        if out and i - out[-1][1] <= args.gap + 1:
+            out[-1][1] = i
+        else:
+            out.append([i, i])
+    return [(start, new[start:end+1]) for start, end in out]
+
+def step_bytes(rl):
+    data = [len(rl)]
+    for start, values in rl:
+        data += [start, len(values)] + values
+    return data
+
+def print_array(name, data):
+    print("const byte %s[%d] = {" % (name, len(data)))
+    for i in range(0, len(data), 16):
+        print("  " + "".join("%d," % x for x in data[i:i+16]))
+    print("};")
+
+print("//", " ".join(["python3", "tools/mkstars.py"] + sys.argv[1:]))
+print("#define STARFIELD_LAYERS %d" % len(layers))
+print()
+# layer in the high nibble, starting character in the low nibble
+columns = [random.randrange(len(layers)) * 16 + random.randrange(16) for x in range(COLUMNS)]
+print_array("star_columns", columns)
+maxruns = 0
+for l, (a, b, color, stars) in enumerate(layers):
+    # one step per a pixels until the layer comes back around
+    nsteps = HEIGHT
+    while nsteps % 2 == 0 and (a * nsteps // 2) % HEIGHT == 0:
+        nsteps //= 2
+    init = runs([0] * HEIGHT, image(stars, 0))
+    steps = []
+    for i in range(nsteps):
+        rl = runs(image(stars, i * a), image(stars, (i + 1) * a))
+        maxruns = max(maxruns, len(rl))
+        steps += step_bytes(rl)
+    print_array("star_init_%d" % l, step_bytes(init))
+    print_array("star_steps_%d" % l, steps + [0xff])
+print("const struct star_layer star_layers[STARFIELD_LAYERS] = {")
+for l, (a, b, color, stars) in enumerate(layers):
+    print("  { star_init_%d, star_steps_%d, %d, %d }," % (l, l, b, color))
+print("};")
+print("// at most %d runs per layer step" % maxruns)
@@ -0,0 +1,639 @@
+
+/*
+psgcomp - make a compressed PSGlib stream (presets/sms-sms-libcv/PSGlib.c)
+from a VGM file or from another PSG stream.
+
+    psgcomp [-p] [-f maxbytes] [-c name] input [output.psg]
+
+- The SN76489 writes are replayed and only the register state at the end
+  of each frame is kept; a register is written only when it changes.
+  Every known register is written again at the loop point, because the
+  state there depends on whether the song just started or looped.
+- Repeated runs of 4-51 bytes become PSGlib substrings (0x08+len-4, then
+  a 16-bit offset into the stream).  The decoder reads a substring's
+  bytes where they are stored, so those have to stay unpacked.  A greedy
+  pass picks the first set of source bytes; then the shortest parse that
+  reads only from those is found, and done again with the sources it
+  doesn't use set free, until nothing changes.
+- A substring costs the decoder 3 more bytes in the frame it starts.
+  No frame may read more than maxbytes (default: the worst frame of the
+  unpacked stream plus 3, so any frame can start one substring), which
+  keeps packing from making frame-time spikes much worse.  -f 0 sets no
+  limit.
+
+-p reads VGM waits as 50 Hz frames instead of 60 Hz.  -c prints a C
+array instead of writing a binary file.  The ratio and the bytes read
+per frame are printed on stderr.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PSG_END		0x00
+#define PSG_LOOP	0x01
+#define PSG_SUBSTRING	0x08
+#define PSG_WAIT	0x38
+#define PSG_DATA	0x40
+#define PSG_LATCH	0x80
+
+#define MIN_SUBSTRING	4
+#define MAX_SUBSTRING	51
+#define MAX_CHAIN	1024
+#define HASH_SIZE	65536
+
+typedef struct {
+  int lo[4];	// tone low 4 bits (channel 3: noise control), -1 = unknown
+  int hi[3];	// tone high 6 bits
+  int vol[4];	// attenuation
+} PSGState;
+
+static unsigned char *in;
+static long inlen;
+
+static PSGState *frames;
+static int nframes, maxframes;
+static int loop_frame = -1;
+static long writes_in;
+
+static PSGState cur;
+static int latch_ch, latch_vol;
+
+// the unpacked stream
+static unsigned char *raw;
+static int rawlen;
+static char *forbid;	// loop and end markers can't be in a substring
+static int *rawcall;	// decode call (PSGFrame) that reads each byte
+static int ncalls, loop_call = -1;
+
+static void *xalloc(size_t n) {
+  void *p = calloc(n, 1);
+  if (!p) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  return p;
+}
+
+static void state_unknown(PSGState *s) {
+  memset(s, 0xff, sizeof(*s));
+}
+
+static void end_frame() {
+  if (nframes == maxframes) {
+    maxframes = maxframes ? maxframes*2 : 1024;
+    frames = realloc(frames, maxframes * sizeof(PSGState));
+    if (!frames) {
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+  }
+  frames[nframes++] = cur;
+}
+
+static void psg_write(int b) {
+  writes_in++;
+  if (b & PSG_LATCH) {
+    latch_ch = (b >> 5) & 3;
+    latch_vol = (b >> 4) & 1;
+    if (latch_vol)
+      cur.vol[latch_ch] = b & 15;
+    else
+      cur.lo[latch_ch] = latch_ch == 3 ? b & 7 : b & 15;
+  } else {
+    // a data byte goes to the last latched register
+    if (latch_vol)
+      cur.vol[latch_ch] = b & 15;
+    else if (latch_ch == 3)
+      cur.lo[3] = b & 7;
+    else
+      cur.hi[latch_ch] = b & 0x3f;
+  }
+}
+
+static long le32(long ofs) {
+  if (ofs + 4 > inlen) return 0;
+  return in[ofs] | (in[ofs+1] << 8) | (in[ofs+2] << 16) | ((long)in[ofs+3] << 24);
+}
+
+static void parse_vgm(int pal) {
+  long frame_samples = pal ? 882 : 735;
+  long loop = le32(0x1c) ? 0x1c + le32(0x1c) : -1;
+  long pos = 0x40;
+  long t = 0;
+  if (le32(0x08) >= 0x150 && le32(0x34))
+    pos = 0x34 + le32(0x34);
+  while (pos < inlen) {
+    int cmd = in[pos];
+    long len, wait = 0;
+    if (pos == loop)
+      loop_frame = nframes;
+    if (cmd == 0x66)
+      break;
+    if (cmd == 0x4f || cmd == 0x50)
+      len = 2;				// GG stereo, PSG write
+    else if (cmd == 0x61)
+      len = 3;
+    else if (cmd == 0x62 || cmd == 0x63)
+      len = 1;
+    else if (cmd == 0x67)
+      len = 7 + le32(pos + 3);		// data block
+    else if (cmd == 0x68)
+      len = 12;				// PCM RAM write
+    else if (cmd >= 0x70 && cmd <= 0x8f)
+      len = 1;				// waits, YM2612 DAC write and wait
+    else if (cmd >= 0x90 && cmd <= 0x95) {
+      static const int lens[6] = { 5, 5, 6, 11, 2, 5 };
+      len = lens[cmd - 0x90];
+    } else if (cmd >= 0x30 && cmd <= 0x3f)
+      len = 2;
+    else if (cmd >= 0x40 && cmd <= 0x5f)
+      len = 3;				// other chips
+    else if (cmd >= 0xa0 && cmd <= 0xbf)
+      len = 3;
+    else if (cmd >= 0xc0 && cmd <= 0xdf)
+      len = 4;
+    else if (cmd >= 0xe0)
+      len = 5;
+    else {
+      fprintf(stderr, "unknown VGM command %02x at %lx\n", cmd, pos);
+      exit(1);
+    }
+    if (pos + len > inlen) {
+      fprintf(stderr, "VGM command %02x at %lx runs past the end\n", cmd, pos);
+      exit(1);
+    }
+    if (cmd == 0x50)
+      psg_write(in[pos+1]);
+    else if (cmd == 0x61)
+      wait = in[pos+1] | (in[pos+2] << 8);
+    else if (cmd == 0x62)
+      wait = 735;
+    else if (cmd == 0x63)
+      wait = 882;
+    else if (cmd >= 0x70 && cmd <= 0x7f)
+      wait = (cmd & 15) + 1;
+    else if (cmd >= 0x80 && cmd <= 0x8f)
+      wait = cmd & 15;
+    pos += len;
+    t += wait;
+    while (t >= frame_samples) {
+      end_frame();
+      t -= frame_samples;
+    }
+  }
+  if (t > 0)
+    end_frame();
+}
+
+static void parse_psg() {
+  long pos = 0, ret = 0;
+  int sub = 0;
+  while (pos < inlen) {
+    int b = in[pos++];
+    if (sub && --sub == 0)
+      pos = ret;
+    if (b >= PSG_DATA) {
+      psg_write(b);
+    } else if (b >= PSG_WAIT) {
+      int n = (b & 7) + 1;
+      while (n--)
+        end_frame();
+    } else if (b >= PSG_SUBSTRING) {
+      if (sub || pos + 2 > inlen) {
+        fprintf(stderr, "bad substring at %lx\n", pos - 1);
+        exit(1);
+      }
+      sub = b - PSG_SUBSTRING + MIN_SUBSTRING;
+      ret = pos + 2;
+      pos = in[pos] | (in[pos+1] << 8);
+    } else if (b == PSG_LOOP) {
+      loop_frame = nframes;
+    } else if (b == PSG_END) {
+      break;
+    }
+  }
+}
+
+static int rawmax;
+
+static void put(int b, int forbidden) {
+  if (rawlen == rawmax) {
+    rawmax = rawmax ? rawmax*2 : 4096;
+    raw = realloc(raw, rawmax);
+    forbid = realloc(forbid, rawmax);
+    rawcall = realloc(rawcall, rawmax * sizeof(int));
+    if (!raw || !forbid || !rawcall) {
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+  }
+  raw[rawlen] = b;
+  forbid[rawlen] = forbidden;
+  rawcall[rawlen] = ncalls;
+  rawlen++;
+  if (b >= PSG_WAIT && b < PSG_DATA)
+    ncalls++;
+}
+
+// write the registers that differ from prev; returns the byte count
+static int put_changes(const PSGState *prev, const PSGState *s, int dry) {
+  int ch, n = 0;
+  for (ch=0; ch<4; ch++) {
+    int lo = s->lo[ch] != prev->lo[ch] && s->lo[ch] >= 0;
+    int hi = ch < 3 && s->hi[ch] != prev->hi[ch] && s->hi[ch] >= 0;
+    if (lo || hi) {
+      // data bytes follow a latch, which also sets the low bits
+      if (s->lo[ch] < 0)
+        continue;
+      n++;
+      if (!dry) put(PSG_LATCH | (ch << 5) | s->lo[ch], 0);
+    }
+    if (hi) {
+      n++;
+      if (!dry) put(PSG_DATA | s->hi[ch], 0);
+    }
+  }
+  for (ch=0; ch<4; ch++) {
+    if (s->vol[ch] != prev->vol[ch] && s->vol[ch] >= 0) {
+      n++;
+      if (!dry) put(PSG_LATCH | (ch << 5) | 0x10 | s->vol[ch], 0);
+    }
+  }
+  return n;
+}
+
+static void put_frames() {
+  PSGState prev;
+  int f = 0;
+  state_unknown(&prev);
+  while (f < nframes) {
+    int n = 1;
+    if (f == loop_frame) {
+      put(PSG_LOOP, 1);
+      loop_call = ncalls;
+      state_unknown(&prev);
+    }
+    put_changes(&prev, &frames[f], 0);
+    prev = frames[f];
+    // frames with nothing to write go in the same wait
+    while (f + n < nframes && f + n != loop_frame &&
+           put_changes(&prev, &frames[f+n], 1) == 0)
+      n++;
+    f += n;
+    while (n > 0) {
+      int k = n > 8 ? 8 : n;
+      put(PSG_WAIT + k - 1, 0);
+      n -= k;
+    }
+  }
+  put(PSG_END, 1);
+}
+
+// substring search
+
+static int *chain_head, *chain_next;
+
+// the parse: sublen[i] = length of the substring that starts at i, or 0
+static int *cost, *sublen, *subsrc;
+static int *bestlen, *bestsrc;
+static char *nostart, *literal, *pinned, *newpin;
+
+static int hash4(int i) {
+  return ((raw[i] << 12) ^ (raw[i+1] << 8) ^ (raw[i+2] << 4) ^ raw[i+3]) & (HASH_SIZE-1);
+}
+
+static void hash_runs() {
+  int i;
+  chain_head = xalloc(HASH_SIZE * sizeof(int));
+  chain_next = xalloc(rawlen * sizeof(int));
+  for (i=0; i<HASH_SIZE; i++)
+    chain_head[i] = -1;
+  for (i=rawlen-MIN_SUBSTRING; i>=0; i--) {
+    int h = hash4(i);
+    chain_next[i] = chain_head[h];
+    chain_head[h] = i;
+  }
+}
+
+// how much of the run at i can be read from j: no overlap, no markers,
+// and only bytes marked in src
+static int match(int i, int j, const char *src) {
+  int m = 0;
+  int gap = i > j ? i - j : j - i;
+  while (m < MAX_SUBSTRING && m < gap && i + m < rawlen && j + m < rawlen &&
+         raw[i+m] == raw[j+m] && !forbid[i+m] && !forbid[j+m] && src[j+m])
+    m++;
+  return m;
+}
+
+static int longest(int i, const char *src, int *from) {
+  int j, k = 0, best = 0;
+  if (i + MIN_SUBSTRING > rawlen)
+    return 0;
+  for (j=chain_head[hash4(i)]; j>=0 && k<MAX_CHAIN; j=chain_next[j], k++) {
+    int m = match(i, j, src);
+    if (m > best) {
+      best = m;
+      *from = j;
+    }
+  }
+  return best;
+}
+
+// first guess: from the start, take the longest earlier run that is
+// stored as-is
+static void greedy_parse() {
+  int i = 0;
+  memset(literal, 0, rawlen);
+  memset(sublen, 0, rawlen * sizeof(int));
+  while (i < rawlen) {
+    int len = longest(i, literal, &subsrc[i]);
+    if (len >= MIN_SUBSTRING) {
+      sublen[i] = len;
+      i += len;
+    } else {
+      literal[i++] = 1;
+    }
+  }
+}
+
+// pin the bytes the substrings read as literals; returns 1 if they changed
+static int pin_sources() {
+  int i, changed;
+  memset(newpin, 0, rawlen);
+  for (i=0; i<rawlen; i++)
+    if (sublen[i])
+      memset(newpin + subsrc[i], 1, sublen[i]);
+  changed = memcmp(newpin, pinned, rawlen) != 0;
+  memcpy(pinned, newpin, rawlen);
+  return changed;
+}
+
+// the shortest stream that reads substrings only from pinned bytes and
+// leaves those as they are
+static void shortest_parse() {
+  int i;
+  for (i=0; i<rawlen; i++)
+    bestlen[i] = longest(i, pinned, &bestsrc[i]);
+  cost[rawlen] = 0;
+  for (i=rawlen-1; i>=0; i--) {
+    int len;
+    cost[i] = cost[i+1] + 1;
+    sublen[i] = 0;
+    if (nostart[i])
+      continue;
+    for (len=1; len<=bestlen[i]; len++) {
+      if (pinned[i+len-1])
+        break;
+      if (len >= MIN_SUBSTRING && cost[i+len] + 3 < cost[i]) {
+        cost[i] = cost[i+len] + 3;
+        sublen[i] = len;
+      }
+    }
+  }
+  // keep the choices on the path from the start
+  for (i=0; i<rawlen; ) {
+    int len = sublen[i];
+    if (len) {
+      subsrc[i] = bestsrc[i];
+      memset(sublen + i + 1, 0, (len - 1) * sizeof(int));
+      i += len;
+    } else {
+      i++;
+    }
+  }
+}
+
+// bytes the decoder reads in each call; the call that reaches the end
+// also reads from the loop point up to its first wait
+static void call_bytes(int *bytes, int packed) {
+  int i;
+  memset(bytes, 0, (ncalls + 1) * sizeof(int));
+  for (i=0; i<rawlen; i++) {
+    bytes[rawcall[i]]++;
+    if (packed && sublen[i])
+      bytes[rawcall[i]] += 3;
+  }
+  if (loop_call >= 0 && loop_call < ncalls)
+    bytes[ncalls] += bytes[loop_call] - 1;	// not the loop marker
+}
+
+// drop the shortest substrings from calls that read too much
+static int limit_calls(int *bytes, int maxbytes) {
+  int i, changes = 0;
+  call_bytes(bytes, 1);
+  while (1) {
+    int over = -1, drop = -1;
+    for (i=0; i<=ncalls; i++)
+      if (bytes[i] > maxbytes) {
+        over = i;
+        break;
+      }
+    if (over < 0)
+      return changes;
+    for (i=0; i<rawlen; i++) {
+      int c = rawcall[i];
+      if (sublen[i] && !nostart[i] &&
+          (c == over || (over == ncalls && c == loop_call)) &&
+          (drop < 0 || sublen[i] < sublen[drop]))
+        drop = i;
+    }
+    if (drop < 0) {
+      fprintf(stderr, "can't fit frame in %d bytes\n", maxbytes);
+      exit(1);
+    }
+    nostart[drop] = 1;
+    bytes[rawcall[drop]] -= 3;
+    if (rawcall[drop] == loop_call)
+      bytes[ncalls] -= 3;
+    changes++;
+  }
+}
+
+static int outlen;
+static unsigned char *out;
+
+static void put_packed() {
+  int *ofs = xalloc((rawlen + 1) * sizeof(int));
+  int i, n = 0;
+  for (i=0; i<rawlen; ) {
+    ofs[i] = n;
+    if (sublen[i]) {
+      n += 3;
+      i += sublen[i];
+    } else {
+      n++;
+      i++;
+    }
+  }
+  if (n > 0x10000) {
+    fprintf(stderr, "stream is over 64K\n");
+    exit(1);
+  }
+  out = xalloc(n);
+  for (i=0; i<rawlen; ) {
+    if (sublen[i]) {
+      int o = ofs[subsrc[i]];
+      out[outlen++] = PSG_SUBSTRING + sublen[i] - MIN_SUBSTRING;
+      out[outlen++] = o & 0xff;
+      out[outlen++] = o >> 8;
+      i += sublen[i];
+    } else {
+      out[outlen++] = raw[i++];
+    }
+  }
+  free(ofs);
+}
+
+// read the packed stream back the way PSGlib does
+static void check_packed() {
+  int pos = 0, ret = 0, sub = 0, n = 0;
+  while (n < rawlen) {
+    int b;
+    if (pos >= outlen)
+      break;
+    b = out[pos++];
+    if (sub && --sub == 0)
+      pos = ret;
+    if (!sub && b >= PSG_SUBSTRING && b < PSG_WAIT) {
+      sub = b - PSG_SUBSTRING + MIN_SUBSTRING;
+      ret = pos + 2;
+      pos = out[pos] | (out[pos+1] << 8);
+      continue;
+    }
+    if (b != raw[n++])
+      break;
+  }
+  if (n != rawlen || pos != outlen) {
+    fprintf(stderr, "packed stream doesn't match at byte %d\n", n);
+    exit(1);
+  }
+}
+
+static void usage() {
+  fprintf(stderr, "usage: psgcomp [-p] [-f maxbytes] [-c name] input [output.psg]\n");
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  int pal = 0, maxbytes = -1;
+  const char *name = NULL;
+  const char *inname = NULL, *outname = NULL;
+  int *rawbytes, *packbytes;
+  int i, pass, worst_raw = 0, worst = 0, sum = 0;
+  long writes_out = 0;
+  FILE *fp;
+
+  for (i=1; i<argc; i++) {
+    if (!strcmp(argv[i], "-p"))
+      pal = 1;
+    else if (!strcmp(argv[i], "-f") && i+1 < argc)
+      maxbytes = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-c") && i+1 < argc)
+      name = argv[++i];
+    else if (argv[i][0] == '-')
+      usage();
+    else if (!inname)
+      inname = argv[i];
+    else if (!outname)
+      outname = argv[i];
+    else
+      usage();
+  }
+  if (!inname || (!outname && !name))
+    usage();
+
+  fp = fopen(inname, "rb");
+  if (!fp) {
+    perror(inname);
+    return 1;
+  }
+  fseek(fp, 0, SEEK_END);
+  inlen = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  in = xalloc(inlen + 4);
+  if (fread(in, 1, inlen, fp) != (size_t)inlen) {
+    perror(inname);
+    return 1;
+  }
+  fclose(fp);
+
+  state_unknown(&cur);
+  if (inlen >= 2 && in[0] == 0x1f && in[1] == 0x8b) {
+    fprintf(stderr, "%s: gunzip .vgz files first\n", inname);
+    return 1;
+  } else if (inlen >= 0x40 && !memcmp(in, "Vgm ", 4)) {
+    parse_vgm(pal);
+  } else {
+    parse_psg();
+  }
+  put_frames();
+
+  rawbytes = xalloc((ncalls + 1) * sizeof(int));
+  packbytes = xalloc((ncalls + 1) * sizeof(int));
+  call_bytes(rawbytes, 0);
+  for (i=0; i<=ncalls; i++)
+    if (rawbytes[i] > worst_raw)
+      worst_raw = rawbytes[i];
+  if (maxbytes < 0)
+    maxbytes = worst_raw + 3;
+
+  cost = xalloc((rawlen + 1) * sizeof(int));
+  sublen = xalloc((rawlen + 1) * sizeof(int));
+  subsrc = xalloc((rawlen + 1) * sizeof(int));
+  bestlen = xalloc((rawlen + 1) * sizeof(int));
+  bestsrc = xalloc((rawlen + 1) * sizeof(int));
+  nostart = xalloc(rawlen + 1);
+  literal = xalloc(rawlen + 1);
+  pinned = xalloc(rawlen + 1);
+  newpin = xalloc(rawlen + 1);
+  hash_runs();
+  greedy_parse();
+  pin_sources();
+  for (pass=1; ; pass++) {
+    int changes;
+    shortest_parse();
+    changes = pin_sources();
+    if (maxbytes > 0)
+      changes += limit_calls(packbytes, maxbytes);
+    if (!changes)
+      break;
+  }
+  put_packed();
+  check_packed();
+
+  call_bytes(packbytes, 1);
+  for (i=0; i<=ncalls; i++) {
+    if (packbytes[i] > worst)
+      worst = packbytes[i];
+    if (i < ncalls)
+      sum += packbytes[i];
+  }
+  for (i=0; i<rawlen; i++)
+    if (raw[i] >= PSG_DATA)
+      writes_out++;
+  fprintf(stderr, "%d frames, %ld register writes in, %ld out\n",
+          nframes, writes_in, writes_out);
+  fprintf(stderr, "%d bytes unpacked, %d packed (%.1f%%) after %d passes\n",
+          rawlen, outlen, 100.0 * outlen / rawlen, pass);
+  fprintf(stderr, "bytes read per frame: worst %d (%d unpacked), average %.2f\n",
+          worst, worst_raw, nframes ? (double)sum / nframes : 0.0);
+
+  if (name) {
+    printf("/* generated by tools/psgcomp from %s -- do not edit */\n", inname);
+    printf("const unsigned char %s[%d] = {", name, outlen);
+    for (i=0; i<outlen; i++)
+      printf("%s0x%02x,", i % 16 ? "" : "\n  ", out[i]);
+    printf("\n};\n");
+  }
+  if (outname) {
+    fp = fopen(outname, "wb");
+    if (!fp || fwrite(out, 1, outlen, fp) != (size_t)outlen) {
+      perror(outname);
+      return 1;
+    }
+    fclose(fp);
+  }
+  return 0;
+}
@@ -0,0 +1,40 @@
+#!/usr/bin/python3
+
+# Generate per-row occupancy bitmasks for Williams 4bpp sprites.
+# Reads "const byte name[] = { w,h, data... };" arrays from a C file
+# and prints "const word name_mask[h]" arrays, one 16-bit word per row,
+# with the leftmost pixel in bit 15.  Arrays that aren't w,h sprites, like
+# palettes, are left out.
+
+import sys, os, argparse
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..'))
+import carray
+
+parser = argparse.ArgumentParser()
+parser.add_argument('cfile', help="C source file with sprite arrays")
+parser.add_argument('names', nargs='*', help="sprite names (default: all sprites)")
+args = parser.parse_args()
+
+for name, values in carray.read_arrays(args.cfile):
+    if args.names and name not in args.names:
+        continue
+    spr = carray.sprite(values)
+    if not spr:
+        continue
+    width, height, data = spr
+    if width*2 > 16:
+        print("// %s: skipped (%dx%d)" % (name, width*2, height))
+        continue
+    masks = []
+    for y in range(0, height):
+        row = data[y*width:(y+1)*width]
+        mask = 0
+        for x in range(0, width*2):
+            nibble = (row[x>>1] >> 4) if (x & 1) == 0 else (row[x>>1] & 0xf)
+            if nibble:
+                mask |= 0x8000 >> x
+        masks.append(mask)
+    print("const word %s_mask[%d] = {" % (name, height))
+    print("  " + ",".join(['0x%04x' % v for v in masks]))
+    print("};")
@@ -0,0 +1,178 @@
+#!/usr/bin/python3
+
+# Convert a color-mapped TGA (8 colors or less, 8 bits/pixel, raw or RLE)
+# into a stream of Williams blitter operations for draw_blit_rle()
+# in presets/williams-z80/bitmap_rle.c
+#
+# Each scanline is split into solid fills and literal copies by a search
+# that weighs load time against stream size. The blitter takes the same
+# time per byte for a fill as for a copy, so a run only pays as a fill
+# because it saves ROM: it needs to save more bytes than the extra blit
+# setups cost, so the run threshold goes up with the setup cost. Spans
+# that continue a fill or copy from the line above cost no setup, since
+# they are merged into one rectangle (the blitter reads the source
+# rectangle row by row).
+#
+# The default costs are Z80 T-states measured for blit_ops() in
+# bitmap_rle.c; the blitter moves a byte in 2 cycles at 1 MHz, which is
+# 8 T-states at 4 MHz.
+#
+# Stream format:
+#   width (bytes), height, # palette entries, palette...
+#   1, x, y, w, h, color     -- solid fill
+#   2, x, y, w, h, data[w*h] -- copy from ROM
+#   0                        -- end
+
+import sys, argparse
+
+parser = argparse.ArgumentParser()
+parser.add_argument('-n', '--name', default='image_blit', help="C array name")
+parser.add_argument('-s', '--setup', type=int, default=280, help="CPU cycles to decode and start a blit")
+parser.add_argument('-k', '--skip', type=int, default=400, help="extra CPU cycles to step over a copy's data")
+parser.add_argument('-c', '--copy', type=int, default=8, help="CPU cycles the blitter takes per byte copied")
+parser.add_argument('-f', '--fill', type=int, default=8, help="CPU cycles the blitter takes per byte filled")
+parser.add_argument('-r', '--rom', type=int, default=600, help="load time in CPU cycles worth one byte of ROM")
+parser.add_argument('-z', '--skip-zero', action="store_true", help="don't draw color 0 (screen is cleared)")
+parser.add_argument('tgafile', help="TGA file")
+args = parser.parse_args()
+
+OP_END = 0
+OP_FILL = 1
+OP_COPY = 2
+
+with open(args.tgafile, 'rb') as f:
+    tga = f.read()
+
+idlength = tga[0]
+datatype = tga[2]
+cmaporigin = tga[3] | (tga[4] << 8)
+cmaplength = tga[5] | (tga[6] << 8)
+cmapdepth = tga[7]
+width = tga[12] | (tga[13] << 8)
+height = tga[14] | (tga[15] << 8)
+bpp = tga[16]
+assert datatype in [1, 9], "only color-mapped TGA files supported"
+assert bpp == 8, "only 8 bits/pixel supported"
+assert cmapdepth == 24, "only 24-bit palettes supported"
+assert cmaplength <= 16, "too many colors"
+ofs = 18 + idlength
+
+# same conversion as draw_tga()
+palette = []
+for i in range(0, cmaplength):
+    p = tga[ofs:ofs+3]
+    palette.append((p[0] >> 5) | ((p[1] >> 2) & 0x38) | (p[2] & 0xc0))
+    ofs += 3
+
+# decode pixels
+pixels = []
+while len(pixels) < width*height:
+    if datatype == 9:
+        count = tga[ofs]
+        ofs += 1
+        if count & 0x80:
+            pixels += [tga[ofs]] * ((count & 0x7f) + 1)
+            ofs += 1
+        else:
+            pixels += tga[ofs:ofs+count+1]
+            ofs += count+1
+    else:
+        pixels.append(tga[ofs])
+        ofs += 1
+
+# pack two 4-bit pixels per byte, left pixel in high nibble
+wbytes = (width+1) // 2
+rows = []
+for y in range(0, height):
+    row = pixels[y*width:(y+1)*width] + [0]
+    rows.append([((row[x] & 0xf) << 4) | (row[x+1] & 0xf) for x in range(0, wbytes*2, 2)])
+
+def encode_row(row, open_fills, open_copies):
+    n = len(row)
+    INF = 1 << 30
+    best = [INF] * (n+1)
+    choice = [None] * (n+1)
+    best[0] = 0
+    for i in range(0, n):
+        if best[i] == INF:
+            continue
+        run = True
+        for j in range(i+1, n+1):
+            span = j - i
+            # literal copy
+            cost = best[i] + args.copy*span + args.rom*span
+            if (i, span) not in open_copies:
+                cost += args.setup + args.skip + args.rom*5
+            if cost < best[j]:
+                best[j] = cost
+                choice[j] = (OP_COPY, i)
+            # no longer runs can start at i once the run is broken
+            run = run and row[j-1] == row[i]
+            if not run:
+                continue
+            # solid fill, or nothing at all
+            if row[i] == 0 and args.skip_zero:
+                cost = best[i]
+                op = OP_END
+            else:
+                cost = best[i] + args.fill*span
+                if (i, span, row[i]) not in open_fills:
+                    cost += args.setup + args.rom*6
+                op = OP_FILL
+            if cost < best[j]:
+                best[j] = cost
+                choice[j] = (op, i)
+    ops = []
+    j = n
+    while j > 0:
+        op, i = choice[j]
+        if op != OP_END:
+            ops.append((op, i, j-i))
+        j = i
+    ops.reverse()
+    return ops
+
+fills = []  # [x, y, w, h, color]
+copies = [] # [x, y, w, h, data]
+open_fills = {}
+open_copies = {}
+for y in range(0, height):
+    row = rows[y]
+    next_open = {}
+    next_copies = {}
+    for op, x, w in encode_row(row, open_fills, open_copies):
+        if op == OP_FILL:
+            key = (x, w, row[x])
+            fill = open_fills.get(key)
+            if fill:
+                fill[3] += 1
+            else:
+                fill = [x, y, w, 1, row[x]]
+                fills.append(fill)
+            next_open[key] = fill
+        else:
+            copy = open_copies.get((x, w))
+            if copy:
+                copy[3] += 1
+                copy[4] += row[x:x+w]
+            else:
+                copy = [x, y, w, 1, row[x:x+w]]
+                copies.append(copy)
+            next_copies[(x, w)] = copy
+    open_fills = next_open
+    open_copies = next_copies
+
+# emit stream
+out = [wbytes, height, len(palette)] + palette
+for x, y, w, h, color in fills:
+    out += [OP_FILL, x, y, w, h, color]
+for x, y, w, h, data in copies:
+    out += [OP_COPY, x, y, w, h] + data
+out.append(OP_END)
+
+print("// %s: %dx%d, %d fills, %d copies, %d bytes (TGA %d bytes)" %
+      (args.tgafile, width, height, len(fills), len(copies), len(out), len(tga)))
+print("const byte %s[%d] = {" % (args.name, len(out)))
+for i in range(0, len(out), 16):
+    print(''.join(['0x%02x,' % v for v in out[i:i+16]]))
+print("};")